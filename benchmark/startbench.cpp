@@ -0,0 +1,458 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        startbench.cpp
+// Purpose:     wxStartPage benchmarks
+// Author:      Blake Madden
+// Created:     10/16/2026
+// Copyright:   (c) Blake Madden
+// License:     BSD-3-Clause
+/////////////////////////////////////////////////////////////////////////////
+
+// Measures loading the MRU list, laying out, and drawing the start page.
+// Each case is run a fixed number of times (five repetitions, reporting the
+// median), with a fixed clock and fixed window size, so that runs are
+// comparable. On Linux, run it under Xvfb for reproducible results:
+//
+//     xvfb-run -a -s "-screen 0 1280x1024x24" ./startpagebench [max files]
+
+#include <wx/wx.h>
+#include <wx/cmdline.h>
+#include <wx/dir.h>
+#include <wx/file.h>
+#include <wx/filename.h>
+#include "../startpage.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <map>
+#include <new>
+#include <vector>
+
+// ----------------------------------------------------------------------------
+// allocation counting
+// ----------------------------------------------------------------------------
+
+// (only allocations through operator new are counted, not the toolkit's own)
+namespace
+{
+std::atomic<size_t> allocationCount{ 0 };
+}
+
+// NOLINTBEGIN(cppcoreguidelines-no-malloc,hicpp-no-malloc)
+void* operator new(const size_t size)
+{
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    if (void* memory = std::malloc(size != 0 ? size : 1))
+    {
+        return memory;
+    }
+    throw std::bad_alloc{};
+}
+
+void* operator new[](const size_t size)
+{
+    return ::operator new(size);
+}
+
+void operator delete(void* memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete[](void* memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void* memory, [[maybe_unused]] const size_t size) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete[](void* memory, [[maybe_unused]] const size_t size) noexcept
+{
+    std::free(memory);
+}
+// NOLINTEND(cppcoreguidelines-no-malloc,hicpp-no-malloc)
+
+// ----------------------------------------------------------------------------
+// benchmark runner
+// ----------------------------------------------------------------------------
+
+namespace
+{
+constexpr size_t REPETITIONS{ 5 };
+const wxSize PAGE_SIZE{ 900, 700 };
+
+/// @brief Runs an operation a fixed number of times per repetition and prints
+///     the median time and allocations per operation.
+/// @param name The name of the case.
+/// @param iterations How many times to run the operation per repetition.
+/// @param operation The operation, which is passed its iteration.
+void RunCase(const wxString& name, const size_t iterations,
+             const std::function<void(size_t)>& operation)
+{
+    // warm up (e.g., caches filled on first use)
+    operation(0);
+
+    std::vector<double> nsPerOp;
+    std::vector<double> allocationsPerOp;
+    for (size_t rep = 0; rep < REPETITIONS; ++rep)
+    {
+        const size_t startAllocations{ allocationCount.load() };
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < iterations; ++i)
+        {
+            operation(i);
+        }
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        nsPerOp.push_back(
+            std::chrono::duration<double, std::nano>(elapsed).count() / iterations);
+        allocationsPerOp.push_back(
+            static_cast<double>(allocationCount.load() - startAllocations) / iterations);
+    }
+
+    const auto median = [](std::vector<double>& values)
+        {
+            std::nth_element(values.begin(), values.begin() + (values.size() / 2), values.end());
+            return values[values.size() / 2];
+        };
+    std::printf("%-32s %14.0f ns/op %12.1f allocs/op\n",
+                static_cast<const char*>(name.utf8_str()),
+                median(nsPerOp), median(allocationsPerOp));
+    std::fflush(stdout);
+}
+} // namespace
+
+// ----------------------------------------------------------------------------
+// the application class
+// ----------------------------------------------------------------------------
+
+class BenchApp : public wxApp
+{
+public:
+    bool OnInit() override;
+    int OnRun() override;
+    void OnInitCmdLine(wxCmdLineParser& parser) override;
+    bool OnCmdLineParsed(wxCmdLineParser& parser) override;
+private:
+    /// @returns Paths of empty files in a temporary folder (which are created here),
+    ///     or an empty list (with the folder removed) if they couldn't be created.
+    wxArrayString CreateFiles(const size_t count);
+    /// @brief Has the start page look up the files' modified times in @c m_modTimes.
+    void UseModTimesTable();
+    void BenchmarkMRUList(const wxArrayString& files);
+    void BenchmarkPage(const wxArrayString& files);
+    /// @returns @c true if every file is still shown after saving the metadata
+    ///     cache and loading the list from it (with the first page sorted).
+    bool CheckFileInfoCache(const wxArrayString& files);
+    int RunBenchmarks();
+
+    size_t m_maxFiles{ 100'000 };
+    wxString m_filesDir;
+    // the files' metadata, which the start page reads for as long as it exists
+    // (so this lives as long as the application does)
+    std::map<wxString, wxDateTime> m_modTimes;
+    wxFrame* m_frame{ nullptr };
+    wxStartPage* m_startPage{ nullptr };
+    int m_exitCode{ EXIT_SUCCESS };
+};
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-pro-type-static-cast-downcast)
+wxIMPLEMENT_APP(BenchApp);
+// NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables,cppcoreguidelines-pro-type-static-cast-downcast)
+
+//---------------------------------------------------
+void BenchApp::OnInitCmdLine(wxCmdLineParser& parser)
+{
+    wxApp::OnInitCmdLine(parser);
+    parser.AddParam(L"max files", wxCMD_LINE_VAL_NUMBER, wxCMD_LINE_PARAM_OPTIONAL);
+}
+
+//---------------------------------------------------
+bool BenchApp::OnCmdLineParsed(wxCmdLineParser& parser)
+{
+    if (parser.GetParamCount() > 0)
+    {
+        unsigned long maxFiles{ 0 };
+        if (!parser.GetParam(0).ToULong(&maxFiles) || maxFiles == 0)
+        {
+            wxLogError(L"Invalid maximum number of files: '%s'", parser.GetParam(0));
+            return false;
+        }
+        m_maxFiles = maxFiles;
+    }
+    return wxApp::OnCmdLineParsed(parser);
+}
+
+//---------------------------------------------------
+bool BenchApp::OnInit()
+{
+    if (!wxApp::OnInit())
+    {
+        return false;
+    }
+
+    SetAppName(L"Start Page Benchmarks");
+
+    m_frame = new wxFrame(nullptr, wxID_ANY, GetAppName());
+    m_startPage = new wxStartPage(m_frame, wxID_ANY);
+    m_startPage->AddButton(wxART_FILE_OPEN, L"Open File");
+    m_startPage->AddButton(wxART_HELP, L"Help");
+    m_startPage->AddButton(wxART_QUIT, L"Exit");
+    // a fixed "now," so that the modified time labels are the same every run
+    m_startPage->SetClock([]() { return wxDateTime{ 1, wxDateTime::Jun, 2026, 12, 0, 0 }; });
+    m_frame->SetClientSize(PAGE_SIZE);
+    m_frame->Show();
+
+    // run once the window is shown
+    CallAfter([this]()
+        {
+            m_exitCode = RunBenchmarks();
+            m_frame->Destroy();
+        });
+
+    return true;
+}
+
+//---------------------------------------------------
+int BenchApp::OnRun()
+{
+    wxApp::OnRun();
+    return m_exitCode;
+}
+
+//---------------------------------------------------
+wxArrayString BenchApp::CreateFiles(const size_t count)
+{
+    m_filesDir = wxFileName::CreateTempFileName(wxFileName::GetTempDir() + L"/startpagebench");
+    wxRemoveFile(m_filesDir);
+    if (!wxFileName::Mkdir(m_filesDir, wxS_DIR_DEFAULT, wxPATH_MKDIR_FULL))
+    {
+        return wxArrayString{};
+    }
+    // don't leave what was created behind if the rest can't be
+    const auto removeFiles = [this]()
+        {
+            wxFileName::Rmdir(m_filesDir, wxPATH_RMDIR_RECURSIVE);
+            return wxArrayString{};
+        };
+
+    // spread across folders, like a real history would be
+    constexpr size_t FILES_PER_FOLDER{ 1'000 };
+    wxArrayString files;
+    files.reserve(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        const wxString folder = wxString{ m_filesDir } << L"/folder" << (i / FILES_PER_FOLDER);
+        if (i % FILES_PER_FOLDER == 0 && !wxFileName::Mkdir(folder))
+        {
+            return removeFiles();
+        }
+        const wxString filePath = wxString{ folder } << L"/report " << i << L".pdf";
+        wxFile file;
+        if (!file.Create(filePath, true))
+        {
+            return removeFiles();
+        }
+        files.push_back(filePath);
+    }
+    return files;
+}
+
+//---------------------------------------------------
+void BenchApp::BenchmarkMRUList(const wxArrayString& files)
+{
+    for (size_t fileCount = 10; fileCount <= files.size(); fileCount *= 10)
+    {
+        // alternate between two lists, since setting the same list does nothing
+        wxArrayString fullList;
+        fullList.assign(files.begin(), files.begin() + fileCount);
+        wxArrayString shortList{ fullList };
+        shortList.pop_back();
+
+        RunCase(wxString{ L"SetMRUList (" } << fileCount << L" files)",
+                std::max<size_t>(5, 100'000 / fileCount),
+                [this, &fullList, &shortList](const size_t i)
+                { m_startPage->SetMRUList((i % 2 == 0) ? shortList : fullList); });
+        // handle the results of the background probes that have finished so far
+        // (the rest are dropped when the next list is set)
+        wxYield();
+    }
+}
+
+//---------------------------------------------------
+void BenchApp::UseModTimesTable()
+{
+    m_startPage->SetFileInfoSource([this](const wxString& filePath)
+        {
+            const auto modTime = m_modTimes.find(filePath);
+            return (modTime != m_modTimes.cend()) ? modTime->second : wxDateTime{};
+        });
+}
+
+//---------------------------------------------------
+void BenchApp::BenchmarkPage(const wxArrayString& files)
+{
+    // the files' metadata comes from a table, so that the same rows are shown every run
+    m_modTimes.clear();
+    const wxDateTime now{ 1, wxDateTime::Jun, 2026, 12, 0, 0 };
+    for (size_t i = 0; i < files.size(); ++i)
+    {
+        m_modTimes[files[i]] = now - wxTimeSpan::Minutes(static_cast<long>(i * 37));
+    }
+    UseModTimesTable();
+    m_startPage->SetMRUList(files);
+    m_startPage->Update();
+
+    // the layout, as when the window is resized
+    RunCase(L"Layout (resize)", 500,
+            [this]([[maybe_unused]] const size_t i) { m_startPage->SendSizeEvent(); });
+
+    // interactively resizing the window (which only moves the areas,
+    // and draws the backdrop straight to the window until the resizing settles)
+    const std::array<wxSize, 2> resizeSizes{ PAGE_SIZE, PAGE_SIZE - wxSize{ 40, 40 } };
+    RunCase(L"Live resize (paint)", 100,
+            [this, &resizeSizes](const size_t i)
+            {
+                m_frame->SetClientSize(resizeSizes[(i + 1) % 2]);
+                m_startPage->Update();
+            });
+    m_frame->SetClientSize(PAGE_SIZE);
+
+    // the whole page, including its layout and backdrop
+    RunCase(L"Full paint", 100,
+            [this]([[maybe_unused]] const size_t i)
+            { [[maybe_unused]] const wxBitmap page{ m_startPage->RenderToBitmap(PAGE_SIZE) }; });
+
+    // each rendering backend (the default is picked at compile time, so this shows
+    // whether it is the faster one on this machine)
+    const std::array<std::pair<wxStartPageRenderer, const wchar_t*>, 2> renderers{
+        std::make_pair(wxStartPageRenderer::wxStartPageDCRenderer, L"DC"),
+        std::make_pair(wxStartPageRenderer::wxStartPageGCDCRenderer, L"GCDC")
+    };
+    for (const auto& [renderer, rendererName] : renderers)
+    {
+        m_startPage->SetRenderer(renderer);
+        RunCase(wxString{ L"Full paint (" } << rendererName << L")", 100,
+                [this]([[maybe_unused]] const size_t i)
+                { [[maybe_unused]] const wxBitmap page{ m_startPage->RenderToBitmap(PAGE_SIZE) }; });
+        RunCase(wxString{ L"Window paint (" } << rendererName << L")", 100,
+                [this]([[maybe_unused]] const size_t i)
+                {
+                    m_startPage->Refresh();
+                    m_startPage->Update();
+                });
+    }
+    m_startPage->SetRenderer(wxStartPageRenderer::wxStartPageDefaultRenderer);
+
+    // moving the mouse between two rows, which only redraws those rows
+    // (the moves are hit-tested once the pending events are handled,
+    // and painted with the next frame)
+    const wxCoord rowsLeft{ (PAGE_SIZE.GetWidth() * 3) / 4 };
+    const std::array<wxPoint, 2> hoverPoints{ wxPoint{ rowsLeft, 300 }, wxPoint{ rowsLeft, 400 } };
+    const auto moveMouse = [this](const wxPoint& pt)
+        {
+            wxMouseEvent motion{ wxEVT_MOTION };
+            motion.SetPosition(pt);
+            motion.SetEventObject(m_startPage);
+            m_startPage->GetEventHandler()->ProcessEvent(motion);
+        };
+    RunCase(L"Hover paint", 500,
+            [this, &hoverPoints, &moveMouse](const size_t i)
+            {
+                moveMouse(hoverPoints[i % 2]);
+                wxTheApp->ProcessPendingEvents();
+                m_startPage->Update();
+            });
+
+    // a fast sweep across the list (many moves within one frame),
+    // which should still only be hit-tested and painted once
+    RunCase(L"Hover sweep (20 moves/frame)", 500,
+            [this, &hoverPoints, &moveMouse](const size_t i)
+            {
+                const wxPoint& from{ hoverPoints[i % 2] };
+                const wxPoint& to{ hoverPoints[(i + 1) % 2] };
+                constexpr int MOVES{ 20 };
+                for (int move = 1; move <= MOVES; ++move)
+                {
+                    moveMouse(wxPoint{ from.x, from.y + ((to.y - from.y) * move) / MOVES });
+                }
+                wxTheApp->ProcessPendingEvents();
+                m_startPage->Update();
+            });
+
+    // moving down (and back up) through the MRU list with the keyboard
+    RunCase(L"Keyboard navigation", 500,
+            [this](const size_t i)
+            {
+                wxKeyEvent key{ wxEVT_KEY_DOWN };
+                key.m_keyCode = (i % 2 == 0) ? WXK_DOWN : WXK_UP;
+                key.SetEventObject(m_startPage);
+                m_startPage->GetEventHandler()->ProcessEvent(key);
+                m_startPage->Update();
+            });
+}
+
+//---------------------------------------------------
+bool BenchApp::CheckFileInfoCache(const wxArrayString& files)
+{
+    // the files are oldest first, so that sorting the first page reverses it
+    // (and the rows are no longer in the same order as the list)
+    m_modTimes.clear();
+    const wxDateTime now{ 1, wxDateTime::Jun, 2026, 12, 0, 0 };
+    for (size_t i = 0; i < files.size(); ++i)
+    {
+        m_modTimes[files[i]] = now - wxTimeSpan::Minutes(static_cast<long>((files.size() - i) * 37));
+    }
+    const wxString cachePath{ m_filesDir + L"/mru.cache" };
+    m_startPage->SetFileInfoCachePath(cachePath);
+    UseModTimesTable();
+    m_startPage->SetMRUList(files);
+    const bool saved{ m_startPage->SaveFileInfoCache() };
+
+    // reloads the list, from the cache this time
+    m_startPage->SetFileInfoSource({});
+    const size_t shownCount{ m_startPage->GetMRUFileCount() };
+
+    m_startPage->SetFileInfoCachePath(wxString{});
+    wxRemoveFile(cachePath);
+    if (!saved || shownCount != files.size())
+    {
+        std::fprintf(stderr, "Metadata cache round trip failed: %zu of %zu files shown.\n",
+                     shownCount, files.size());
+        return false;
+    }
+    return true;
+}
+
+//---------------------------------------------------
+int BenchApp::RunBenchmarks()
+{
+    std::printf("Creating %zu files...\n", m_maxFiles);
+    std::fflush(stdout);
+    const wxArrayString files{ CreateFiles(m_maxFiles) };
+    if (files.size() != m_maxFiles)
+    {
+        std::fprintf(stderr, "Unable to create the files in '%s'.\n",
+                     static_cast<const char*>(m_filesDir.utf8_str()));
+        return EXIT_FAILURE;
+    }
+
+    BenchmarkMRUList(files);
+
+    wxArrayString pageFiles;
+    pageFiles.assign(files.begin(), files.begin() + std::min<size_t>(files.size(), 1'000));
+    if (!CheckFileInfoCache(pageFiles))
+    {
+        wxFileName::Rmdir(m_filesDir, wxPATH_RMDIR_RECURSIVE);
+        return EXIT_FAILURE;
+    }
+    BenchmarkPage(pageFiles);
+
+    wxFileName::Rmdir(m_filesDir, wxPATH_RMDIR_RECURSIVE);
+    return EXIT_SUCCESS;
+}
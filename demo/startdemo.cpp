@@ -107,11 +107,64 @@ MyFrame::MyFrame(const wxString& title)
         wxBitmapBundle::FromSVGFile(appDir + L"/res/x-office-document.svg",
             FromDIP(wxSize(64, 64))));
 
+    // If the MRU list may contain files on slow (or disconnected) network drives,
+    // then the files can be checked on background threads instead.
+    // Uncomment the following to reload the list this way:
+
+    // m_startPage->EnableAsyncFileProbing();
+    // m_startPage->SetMRUList(mruFiles);
+
+    // The files' metadata can also be cached in between sessions, so that the list
+    // is shown right away at startup and then re-checked in the background.
+    // Uncomment the following to reload the list this way:
+
+    // m_startPage->SetFileInfoCachePath(
+    //     wxStandardPaths::Get().GetUserDataDir() + L"/mru.cache");
+    // m_startPage->SetMRUList(mruFiles);
+
+    // Files on network drives can also be handled differently from local files.
+    // Uncomment the following to show unreachable network files as
+    // "unavailable," rather than hiding them:
+
+    // m_startPage->SetRemoteFilePolicy(
+    //     wxStartPageRemoteFilePolicy::wxShowUnavailableRemoteFiles);
+
+    // The files on the first page are sorted by when they were modified.
+    // Uncomment the following to show them in the order they were passed in instead:
+
+    // m_startPage->SetFileOrder(wxStartPageFileOrder::wxClientFileOrder);
+
+    // The start page can also watch the folders of the files in its list
+    // and update them as they are modified, deleted, or recreated.
+    // Uncomment the following to enable this:
+
+    // m_startPage->EnableFileWatching();
+
+    // For long file histories, a search box can be shown above the MRU list
+    // that filters it as the user types. Uncomment the following to show it:
+
+    // m_startPage->EnableFileFilter();
+
     // By default, the application name and its logo are shown on the left
     // (above the custom buttons). Uncomment the following to turn this off:
 
     // m_startPage->SetAppHeaderStyle(wxStartPageAppHeaderStyle::wxStartPageNoHeader);
 
+    // The page is drawn either directly with the window's DC or through a wxGCDC.
+    // By default, the choice is made at compile time from the toolkit: the DC directly
+    // on GTK 3 and macOS, and a wxGCDC elsewhere. (The benchmark reports frame times
+    // for each backend, to check this choice on a given machine.)
+    // Uncomment the following to always draw through a wxGCDC:
+
+    // m_startPage->SetRenderer(wxStartPageRenderer::wxStartPageGCDCRenderer);
+
+    // A timeline of what the start page is doing (e.g., loading the MRU list and
+    // painting) can be recorded and then written to a file that Perfetto or
+    // chrome://tracing can open. Uncomment the following to record it (and then
+    // call wxStartPage::WriteTrace(L"startpage.json") to write it):
+
+    // wxStartPage::EnableTracing();
+
     // Add some custom buttons to appear on the left side.
     // Note that we capture the IDs of the buttons as we add them;
     // we will use this in our wxEVT_STARTPAGE_CLICKED handler.
@@ -7,361 +7,3622 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include "startpage.h"
+#include <wx/bmpbndl.h>
 #include <wx/dcbuffer.h>
+#include <wx/file.h>
+#include <wx/srchctrl.h>
 #include <wx/stdpaths.h>
+#if wxUSE_FSWATCHER
+    #include <wx/fswatcher.h>
+#endif
+#if defined(__WINDOWS__)
+    #include <wx/msw/wrapwin.h>
+#elif defined(__LINUX__)
+    #include <sys/vfs.h>
+#elif defined(__DARWIN__) || defined(__FREEBSD__) || defined(__NETBSD__) || defined(__OPENBSD__)
+    #include <sys/mount.h>
+    #include <sys/param.h>
+#endif
+#if defined(__UNIX__)
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <string_view>
+#include <thread>
+#include <tuple>
+#include <unordered_map>
 #include <utility>
 
 wxDEFINE_EVENT(wxEVT_STARTPAGE_CLICKED, wxCommandEvent);
 
-//-------------------------------------------
-wxStartPage::wxStartPage(wxWindow* parent, wxWindowID id /*= wxID_ANY*/,
-    const wxArrayString& mruFiles /*= wxArrayString{}*/,
-    const wxBitmapBundle& logo /*= wxBitmapBundle{}*/,
-    wxString productDescription /*= wxString{}*/)
-    : wxWindow(parent, id, wxDefaultPosition, wxDefaultSize,
-        wxFULL_REPAINT_ON_RESIZE | wxWANTS_CHARS, L"wxStartPage"),
-    m_logoFont(wxFontInfo(
-        wxSystemSettings::GetFont(wxSYS_DEFAULT_GUI_FONT).
-        GetFractionalPointSize() * 1.5)),
-    m_logo(logo),
-    m_productDescription(std::move(productDescription))
+namespace
 {
-    // Size of an icon scaled to 32x32, with label padding above and below it.
-    // Note that Realise will adjust this later more intelligently.
-    m_buttonHeight = GetButtonSize().GetHeight() + (2 * GetLabelPaddingHeight());
-    m_buttonWidth = FromDIP(wxSize(200, 200)).GetWidth();
-
-    wxWindow::SetBackgroundStyle(wxBG_STYLE_CUSTOM);
-    SetMRUList(mruFiles);
+/// @returns @c true if a path is on a network (or FUSE) file system.
+/// @details This calls @c statfs() (or @c GetDriveType() on Windows) on the
+///     file's folder, which can block on an unresponsive mount; it should
+///     only be called from a probe worker.
+bool IsOnRemoteFileSystem(const wxString& filePath)
+{
+#if defined(__WINDOWS__)
+    // UNC paths (\\server\share) are always on the network
+    if (filePath.StartsWith(L"\\\\"))
+    {
+        return true;
+    }
+    const wxString volume = wxFileName{ filePath }.GetVolume();
+    return !volume.empty() &&
+        ::GetDriveTypeW((volume + L":\\").wc_str()) == DRIVE_REMOTE;
+#elif defined(__LINUX__)
+    struct statfs fsInfo {};
+    if (::statfs(wxFileName{ filePath }.GetPath().fn_str(), &fsInfo) != 0)
+    {
+        return false;
+    }
+    switch (static_cast<unsigned long>(fsInfo.f_type))
+    {
+    case 0x6969UL:     // NFS
+    case 0x517BUL:     // SMB
+    case 0xFF534D42UL: // CIFS
+    case 0xFE534D42UL: // SMB2
+    case 0x65735546UL: // FUSE (sshfs, etc.)
+    case 0x564CUL:     // NCP
+    case 0x73757245UL: // Coda
+    case 0x5346414FUL: // AFS
+    case 0x6B414653UL: // kAFS
+    case 0x01021997UL: // 9P
+    case 0x00C36400UL: // Ceph
+        return true;
+    default:
+        return false;
+    }
+#elif defined(__DARWIN__) || defined(__FREEBSD__) || defined(__NETBSD__) || defined(__OPENBSD__)
+    struct statfs fsInfo {};
+    if (::statfs(wxFileName{ filePath }.GetPath().fn_str(), &fsInfo) != 0)
+    {
+        return false;
+    }
+    return (fsInfo.f_flags & MNT_LOCAL) == 0 ||
+        std::strstr(fsInfo.f_fstypename, "fuse") != nullptr;
+#else
+    wxUnusedVar(filePath);
+    return false;
+#endif
+}
 
-    if (wxSystemSettings::GetAppearance().IsDark())
+/// @brief A read-only view of a file's contents, memory mapped where possible.
+class MappedFile
+{
+public:
+    explicit MappedFile(const wxString& filePath)
     {
-        SetButtonAreaBackgroundColor(wxColour(46, 46, 46));
-        SetMRUBackgroundColor(wxColour(31, 31, 31));
+#if defined(__WINDOWS__)
+        m_file = ::CreateFileW(filePath.wc_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                               OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        LARGE_INTEGER fileSize{};
+        if (m_file == INVALID_HANDLE_VALUE || !::GetFileSizeEx(m_file, &fileSize) ||
+            fileSize.QuadPart == 0)
+        {
+            return;
+        }
+        m_mapping = ::CreateFileMappingW(m_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (m_mapping == nullptr)
+        {
+            return;
+        }
+        m_data = static_cast<const char*>(::MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0));
+        m_size = (m_data != nullptr) ? static_cast<size_t>(fileSize.QuadPart) : 0;
+#elif defined(__UNIX__)
+        m_fd = ::open(filePath.fn_str(), O_RDONLY);
+        struct stat fileInfo {};
+        if (m_fd == -1 || ::fstat(m_fd, &fileInfo) != 0 || fileInfo.st_size == 0)
+        {
+            return;
+        }
+        void* data = ::mmap(nullptr, static_cast<size_t>(fileInfo.st_size), PROT_READ,
+                            MAP_PRIVATE, m_fd, 0);
+        if (data == MAP_FAILED)
+        {
+            return;
+        }
+        m_data = static_cast<const char*>(data);
+        m_size = static_cast<size_t>(fileInfo.st_size);
+#else
+        // no memory mapping, so just read it
+        wxFile file;
+        if (!file.Open(filePath) || file.Length() <= 0)
+        {
+            return;
+        }
+        m_buffer.resize(static_cast<size_t>(file.Length()));
+        if (file.Read(m_buffer.data(), m_buffer.size()) != static_cast<ssize_t>(m_buffer.size()))
+        {
+            return;
+        }
+        m_data = m_buffer.data();
+        m_size = m_buffer.size();
+#endif
     }
 
-    SetCanFocus(true);
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
 
-    Bind(wxEVT_PAINT, &wxStartPage::OnPaintWindow, this);
-    Bind(wxEVT_MOTION, &wxStartPage::OnMouseChange, this);
-    Bind(wxEVT_LEFT_DOWN, &wxStartPage::OnMouseClick, this);
-    Bind(wxEVT_LEAVE_WINDOW, &wxStartPage::OnMouseLeave, this);
-    Bind(wxEVT_SIZE, &wxStartPage::OnResize, this);
-    Bind(wxEVT_KEY_DOWN, &wxStartPage::OnKeyDown, this);
-    Bind(wxEVT_SET_FOCUS, &wxStartPage::OnSetFocus, this);
-    Bind(wxEVT_KILL_FOCUS, &wxStartPage::OnKillFocus, this);
-}
+    ~MappedFile()
+    {
+#if defined(__WINDOWS__)
+        if (m_data != nullptr)
+        {
+            ::UnmapViewOfFile(m_data);
+        }
+        if (m_mapping != nullptr)
+        {
+            ::CloseHandle(m_mapping);
+        }
+        if (m_file != INVALID_HANDLE_VALUE)
+        {
+            ::CloseHandle(m_file);
+        }
+#elif defined(__UNIX__)
+        if (m_data != nullptr)
+        {
+            ::munmap(const_cast<char*>(m_data), m_size);
+        }
+        if (m_fd != -1)
+        {
+            ::close(m_fd);
+        }
+#endif
+    }
 
-//---------------------------------------------------
-void wxStartPage::OnSetFocus(wxFocusEvent& event)
-{
-    if (!m_buttons.empty())
+    [[nodiscard]]
+    const char* GetData() const noexcept
     {
-        m_activeButton = m_buttons[0].m_id;
+        return m_data;
     }
-    else if (!m_fileButtons.empty())
+
+    [[nodiscard]]
+    size_t GetSize() const noexcept
     {
-        m_activeButton = m_fileButtons[0].m_id;
+        return m_size;
     }
-    Refresh();
-    event.Skip();
-}
 
-//---------------------------------------------------
-void wxStartPage::OnKillFocus(wxFocusEvent& event)
+private:
+#if defined(__WINDOWS__)
+    HANDLE m_file{ INVALID_HANDLE_VALUE };
+    HANDLE m_mapping{ nullptr };
+#elif defined(__UNIX__)
+    int m_fd{ -1 };
+#else
+    std::vector<char> m_buffer;
+#endif
+    const char* m_data{ nullptr };
+    size_t m_size{ 0 };
+};
+
+// The metadata cache is a header, followed by an entry for each file
+// (each followed by the file's UTF-8 encoded path).
+// It is read and written in the machine's byte order, since it never leaves the machine.
+constexpr std::array<char, 8> FILE_INFO_CACHE_MAGIC{ 'w', 'x', 'S', 'P', 'M', 'R', 'U', '\0' };
+
+struct FileInfoCacheHeader
 {
-    m_activeButton = wxNOT_FOUND;
-    Refresh();
-    event.Skip();
+    std::array<char, 8> m_magic{};
+    uint32_t m_version{ 0 };
+    uint32_t m_entryCount{ 0 };
+    // HashFileList() of the list that was saved
+    uint64_t m_listHash{ 0 };
+};
+
+struct FileInfoCacheEntry
+{
+    // milliseconds since the epoch (or NO_MOD_TIME)
+    int64_t m_modTime{ 0 };
+    uint64_t m_size{ 0 };
+    uint32_t m_pathLength{ 0 };
+    uint8_t m_flags{ 0 };
+    std::array<uint8_t, 3> m_reserved{};
+
+    static constexpr uint8_t FILE_EXISTS = 0x01;
+    static constexpr uint8_t FILE_REMOTE = 0x02;
+    static constexpr int64_t NO_MOD_TIME = std::numeric_limits<int64_t>::min();
+};
+
+/// @returns @c true if the cache starts with a header from this version of the format.
+bool ReadFileInfoCacheHeader(const MappedFile& cacheFile, const uint32_t version,
+                             FileInfoCacheHeader& header)
+{
+    if (cacheFile.GetSize() < sizeof(FileInfoCacheHeader))
+    {
+        return false;
+    }
+    std::memcpy(&header, cacheFile.GetData(), sizeof(FileInfoCacheHeader));
+    // (a corrupt or truncated file can't claim more entries than it could hold,
+    //  which would otherwise be reserved up front)
+    const size_t maxEntryCount{
+        (cacheFile.GetSize() - sizeof(FileInfoCacheHeader)) / sizeof(FileInfoCacheEntry) };
+    return header.m_magic == FILE_INFO_CACHE_MAGIC && header.m_version == version &&
+        header.m_entryCount <= maxEntryCount;
 }
 
-//---------------------------------------------------
-void wxStartPage::OnKeyDown(wxKeyEvent& event)
+/// @brief Records spans of what start pages are doing (on any thread),
+///     which wxStartPage::WriteTrace() writes as Chrome trace events.
+/// @details Each thread records into its own fixed-size ring buffer, so recording
+///     a span never takes a lock (only a thread's first span registers its buffer).
+///     Once a ring is full, its oldest spans are overwritten.\n
+///     Each slot has a sequence number (odd while it is being written),
+///     so that a span which is overwritten while being exported is skipped
+///     rather than written half-updated.
+class StartPageTracer
 {
-    const int keyCode = event.GetKeyCode();
-    if (keyCode == WXK_UP)
+public:
+    /// @brief The tracer shared by all start pages.
+    /// @note This is never destroyed, since detached probe workers may
+    ///     still be recording while the application exits.
+    static StartPageTracer& Get()
     {
-        if (m_activeButton == wxNOT_FOUND)
+        static auto* tracer = new StartPageTracer;
+        return *tracer;
+    }
+
+    StartPageTracer(const StartPageTracer&) = delete;
+    StartPageTracer& operator=(const StartPageTracer&) = delete;
+
+    void Enable(const bool enable) noexcept
+    {
+        m_enabled.store(enable, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]]
+    bool IsEnabled() const noexcept
+    {
+        return m_enabled.load(std::memory_order_relaxed);
+    }
+
+    /// @returns Nanoseconds since the tracer was created.
+    [[nodiscard]]
+    int64_t Now() const noexcept
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - m_epoch).count();
+    }
+
+    /// @brief Records a span into the calling thread's ring.
+    /// @param name The span's name, which must be a string literal
+    ///     (only the pointer is stored).
+    void Record(const char* name, const int64_t start, const int64_t end) noexcept
+    {
+        ThreadBuffer* buffer = GetThreadBuffer();
+        if (buffer == nullptr)
         {
-            if (!m_buttons.empty())
-            {
-                m_activeButton = m_buttons[0].m_id;
-            }
+            return;
         }
-        else if (IsCustomButtonId(m_activeButton))
-        {
-            size_t idx = m_activeButton - ID_BUTTON_ID_START;
-            if (idx == 0)
+        const uint64_t index{ buffer->m_written.load(std::memory_order_relaxed) };
+        TraceEvent& event = buffer->m_events[index % TRACE_BUFFER_SIZE];
+        const uint32_t sequence{ event.m_sequence.load(std::memory_order_relaxed) };
+        event.m_sequence.store(sequence + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        event.m_name.store(name, std::memory_order_relaxed);
+        event.m_start.store(start, std::memory_order_relaxed);
+        event.m_duration.store(end - start, std::memory_order_relaxed);
+        event.m_sequence.store(sequence + 2, std::memory_order_release);
+        buffer->m_written.store(index + 1, std::memory_order_release);
+    }
+
+    /// @brief Writes the spans in every thread's ring as Chrome trace-event JSON.
+    /// @returns @c true if the file was written.
+    bool Write(const wxString& filePath)
+    {
+        const unsigned long processId{ wxGetProcessId() };
+        std::string json{ "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[" };
+        std::array<char, 256> line{};
+        bool firstEvent{ true };
+        const auto appendEvent = [&json, &line, &firstEvent](const int length)
             {
-                idx = m_buttons.size() - 1;
-            }
-            else
+                if (length <= 0)
+                {
+                    return;
+                }
+                json.append(firstEvent ? "\n" : ",\n");
+                json.append(line.data(),
+                            std::min(static_cast<size_t>(length), line.size() - 1));
+                firstEvent = false;
+            };
+
+        {
+            const std::lock_guard<std::mutex> lock{ m_buffersMutex };
+            for (const auto& buffer : m_buffers)
             {
-                --idx;
+                appendEvent(std::snprintf(line.data(), line.size(),
+                    "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%lu,\"tid\":%u,"
+                    "\"args\":{\"name\":\"%s\"}}",
+                    processId, buffer->m_threadId, buffer->m_threadName));
+
+                const uint64_t written{ buffer->m_written.load(std::memory_order_acquire) };
+                for (uint64_t i = (written > TRACE_BUFFER_SIZE) ? written - TRACE_BUFFER_SIZE : 0;
+                     i < written; ++i)
+                {
+                    const TraceEvent& event = buffer->m_events[i % TRACE_BUFFER_SIZE];
+                    const uint32_t sequence{ event.m_sequence.load(std::memory_order_acquire) };
+                    const char* name{ event.m_name.load(std::memory_order_relaxed) };
+                    const int64_t start{ event.m_start.load(std::memory_order_relaxed) };
+                    const int64_t duration{ event.m_duration.load(std::memory_order_relaxed) };
+                    std::atomic_thread_fence(std::memory_order_acquire);
+                    // being overwritten by its thread right now
+                    if (name == nullptr || (sequence % 2) != 0 ||
+                        event.m_sequence.load(std::memory_order_relaxed) != sequence)
+                    {
+                        continue;
+                    }
+                    // (timestamps are in microseconds)
+                    appendEvent(std::snprintf(line.data(), line.size(),
+                        "{\"name\":\"%s\",\"cat\":\"wxStartPage\",\"ph\":\"X\","
+                        "\"ts\":%.3f,\"dur\":%.3f,\"pid\":%lu,\"tid\":%u}",
+                        name, start / 1000.0, duration / 1000.0,
+                        processId, buffer->m_threadId));
+                }
             }
-            m_activeButton = m_buttons[idx].m_id;
         }
-        else if (IsFileId(m_activeButton) || IsFileListClearId(m_activeButton) ||
-                 IsBrowseId(m_activeButton))
+        json.append("\n]}\n");
+
+        wxFile traceFile;
+        return traceFile.Create(filePath, true) &&
+            traceFile.Write(json.data(), json.size()) == json.size();
+    }
+
+private:
+    StartPageTracer() = default;
+
+    // spans kept per thread (the oldest are overwritten after this)
+    constexpr static size_t TRACE_BUFFER_SIZE{ 8'192 };
+
+    struct TraceEvent
+    {
+        std::atomic<uint32_t> m_sequence{ 0 };
+        std::atomic<const char*> m_name{ nullptr };
+        std::atomic<int64_t> m_start{ 0 };
+        std::atomic<int64_t> m_duration{ 0 };
+    };
+
+    struct ThreadBuffer
+    {
+        std::array<TraceEvent, TRACE_BUFFER_SIZE> m_events;
+        // how many spans have ever been recorded into the ring
+        std::atomic<uint64_t> m_written{ 0 };
+        uint32_t m_threadId{ 0 };
+        const char* m_threadName{ "" };
+        // a buffer whose thread has exited is handed to the next new thread
+        bool m_inUse{ true };
+    };
+
+    /// @brief Gives a buffer back once its thread exits.
+    class ThreadBufferHolder
+    {
+    public:
+        explicit ThreadBufferHolder(ThreadBuffer* buffer) noexcept : m_buffer(buffer) {}
+        ThreadBufferHolder(const ThreadBufferHolder&) = delete;
+        ThreadBufferHolder& operator=(const ThreadBufferHolder&) = delete;
+        ~ThreadBufferHolder()
         {
-            size_t idx = (m_activeButton == START_PAGE_FILE_LIST_CLEAR ||
-                          m_activeButton == START_PAGE_BROWSE_FILE) ?
-                m_fileButtons.size() - 1 :
-                m_activeButton - ID_FILE_ID_START;
-            if (idx == 0)
-            {
-                idx = m_fileButtons.size() - 1;
-            }
-            else
+            if (m_buffer != nullptr)
             {
-                --idx;
+                StartPageTracer::Get().ReleaseBuffer(m_buffer);
             }
-            m_activeButton = m_fileButtons[idx].m_id;
         }
-        Refresh();
+        ThreadBuffer* m_buffer{ nullptr };
+    };
+
+    /// @returns The calling thread's ring (registering one on its first span),
+    ///     or null if one couldn't be allocated.
+    ThreadBuffer* GetThreadBuffer() noexcept
+    {
+        thread_local const ThreadBufferHolder holder{ AcquireBuffer() };
+        return holder.m_buffer;
     }
-    else if (keyCode == WXK_DOWN)
+
+    ThreadBuffer* AcquireBuffer() noexcept
     {
-        if (m_activeButton == wxNOT_FOUND)
+        const std::lock_guard<std::mutex> lock{ m_buffersMutex };
+        const char* threadName{ wxIsMainThread() ? "UI" : "File probe" };
+        for (const auto& buffer : m_buffers)
         {
-            if (!m_buttons.empty())
+            if (!buffer->m_inUse)
             {
-                m_activeButton = m_buttons[0].m_id;
+                buffer->m_inUse = true;
+                buffer->m_threadName = threadName;
+                return buffer.get();
             }
         }
-        else if (IsCustomButtonId(m_activeButton))
+        try
         {
-            size_t idx = m_activeButton - ID_BUTTON_ID_START;
-            idx = (idx + 1) % m_buttons.size();
-            m_activeButton = m_buttons[idx].m_id;
+            auto buffer = std::make_unique<ThreadBuffer>();
+            buffer->m_threadId = static_cast<uint32_t>(m_buffers.size() + 1);
+            buffer->m_threadName = threadName;
+            m_buffers.push_back(std::move(buffer));
+            return m_buffers.back().get();
         }
-        else if (IsFileId(m_activeButton) || IsFileListClearId(m_activeButton) ||
-                 IsBrowseId(m_activeButton))
+        catch (...)
         {
-            size_t idx = (m_activeButton == START_PAGE_FILE_LIST_CLEAR ||
-                          m_activeButton == START_PAGE_BROWSE_FILE) ?
-                m_fileButtons.size() - 1 :
-                m_activeButton - ID_FILE_ID_START;
-            idx = (idx + 1) % m_fileButtons.size();
-            m_activeButton = m_fileButtons[idx].m_id;
+            return nullptr;
         }
-        Refresh();
     }
-    else if (keyCode == WXK_LEFT)
+
+    void ReleaseBuffer(ThreadBuffer* buffer) noexcept
+    {
+        const std::lock_guard<std::mutex> lock{ m_buffersMutex };
+        buffer->m_inUse = false;
+    }
+
+    std::atomic<bool> m_enabled{ false };
+    const std::chrono::steady_clock::time_point m_epoch{ std::chrono::steady_clock::now() };
+    // only locked when a thread records its first span (and while writing the trace)
+    std::mutex m_buffersMutex;
+    std::vector<std::unique_ptr<ThreadBuffer>> m_buffers;
+};
+
+/// @brief Records a span (for the scope that it is in) if tracing is enabled,
+///     otherwise it only checks a flag.
+class TraceSpan
+{
+public:
+    explicit TraceSpan(const char* name) noexcept :
+        m_name(StartPageTracer::Get().IsEnabled() ? name : nullptr),
+        m_start((m_name != nullptr) ? StartPageTracer::Get().Now() : 0)
+    {
+    }
+    TraceSpan(const TraceSpan&) = delete;
+    TraceSpan& operator=(const TraceSpan&) = delete;
+    ~TraceSpan()
     {
-        if ((IsFileId(m_activeButton) || IsFileListClearId(m_activeButton) ||
-            IsBrowseId(m_activeButton)) && !m_buttons.empty())
+        if (m_name != nullptr)
         {
-            m_activeButton = m_buttons[0].m_id;
-            Refresh();
+            StartPageTracer& tracer = StartPageTracer::Get();
+            tracer.Record(m_name, m_start, tracer.Now());
         }
     }
-    else if (keyCode == WXK_RIGHT)
+private:
+    const char* m_name{ nullptr };
+    int64_t m_start{ 0 };
+};
+} // namespace
+
+/// @brief Worker threads that check whether the files in the MRU list exist.
+/// @details The pool is shared between the start page and its worker threads.
+///     A probe that is stuck on an unresponsive network drive keeps the pool
+///     alive after the start page is destroyed, but it will never touch the window.\n
+///     A new thread is started whenever all workers are busy (up to a limit), so
+///     a hung probe doesn't hold up the ones queued behind it, and a thread exits
+///     once it has been idle for a while. Only one file in
+///     a folder is checked at a time, so that a hung mount only ties up one worker
+///     (the rest of its files wait in the queue, and are dropped if they time out).
+class wxStartPage::FileProbePool : public std::enable_shared_from_this<FileProbePool>
+{
+public:
+    using ProbeCallback = std::function<void(const FileProbe&)>;
+
+    /// @brief Creates the pool. Worker threads are started as probes are queued.
+    static std::shared_ptr<FileProbePool> Create(wxStartPage* owner)
+    {
+        return std::shared_ptr<FileProbePool>{ new FileProbePool(owner) };
+    }
+
+    /// @brief Queues a file to be checked.
+    /// @param generation The MRU list that the file belongs to.
+    /// @param filePath The file to check.
+    /// @param remotePolicy How to handle the file if it is on a remote file system.
+    /// @param deferRemote @c true to skip reading a remote file's metadata
+    ///     (see @c wxProbeRemoteFilesLazily).
+    /// @param onProbed Called from the worker thread with the result.
+    void Submit(const size_t generation, wxString filePath,
+                const wxStartPageRemoteFilePolicy remotePolicy, const bool deferRemote,
+                ProbeCallback onProbed)
     {
-        if (IsCustomButtonId(m_activeButton) && !m_fileButtons.empty())
+        bool startWorker{ false };
         {
-            m_activeButton = m_fileButtons[0].m_id;
-            Refresh();
+            const std::lock_guard<std::mutex> lock{ m_mutex };
+            wxString directory{ GetProbeDirectory(filePath) };
+            m_tasks.push_back(ProbeTask{ generation, std::move(filePath), std::move(directory),
+                                         remotePolicy, deferRemote, std::move(onProbed) });
+            if (m_idleWorkerCount < m_tasks.size() && m_workerCount < MAX_PROBE_THREADS)
+            {
+                ++m_workerCount;
+                startWorker = true;
+            }
+        }
+        if (startWorker)
+        {
+            std::thread([pool = shared_from_this()]() { pool->WorkerLoop(); }).detach();
+        }
+        else
+        {
+            m_taskAvailable.notify_one();
         }
     }
-    else if (keyCode == WXK_RETURN || keyCode == WXK_NUMPAD_ENTER || keyCode == WXK_SPACE)
+
+    /// @brief Runs a handler on the UI thread with the window
+    ///     (if it still exists and the MRU list hasn't changed).
+    void PostToOwner(const size_t generation, std::function<void(wxStartPage&)> handler)
     {
-        ActivateButton(m_activeButton);
+        const std::lock_guard<std::mutex> lock{ m_mutex };
+        // the window is gone or a newer list was set while this file was checked
+        if (m_owner == nullptr || generation != m_generation)
+        {
+            return;
+        }
+        wxStartPage* owner{ m_owner };
+        owner->CallAfter([owner, handler = std::move(handler)]() { handler(*owner); });
     }
-    else
+
+    /// @brief Drops a file's probe if it hasn't been started yet.
+    /// @returns @c true if the probe was still queued (so the file wasn't touched).
+    bool Cancel(const wxString& filePath)
     {
-        event.Skip();
+        const std::lock_guard<std::mutex> lock{ m_mutex };
+        const auto queuedTasks = std::remove_if(m_tasks.begin(), m_tasks.end(),
+            [&filePath](const auto& task) { return task.m_filePath == filePath; });
+        const bool cancelled{ queuedTasks != m_tasks.end() };
+        m_tasks.erase(queuedTasks, m_tasks.end());
+        return cancelled;
     }
-}
 
-//---------------------------------------------------
-void wxStartPage::ActivateButton(wxWindowID id)
-{
-    if (id == wxNOT_FOUND)
+    /// @brief Starts a new MRU list; queued probes from older lists are dropped.
+    void SetGeneration(const size_t generation)
     {
-        return;
+        const std::lock_guard<std::mutex> lock{ m_mutex };
+        m_generation = generation;
+        m_tasks.clear();
     }
 
-    if (IsCustomButtonId(id))
+    /// @brief Disconnects the pool from its window and stops the workers.
+    void Shutdown()
     {
-        wxCommandEvent cevent(wxEVT_STARTPAGE_CLICKED, GetId());
-        cevent.SetId(id);
-        cevent.SetInt(id);
-        cevent.SetEventObject(this);
-        GetEventHandler()->ProcessEvent(cevent);
+        {
+            const std::lock_guard<std::mutex> lock{ m_mutex };
+            m_owner = nullptr;
+            m_tasks.clear();
+        }
+        m_taskAvailable.notify_all();
+    }
+
+private:
+    struct ProbeTask
+    {
+        size_t m_generation{ 0 };
+        wxString m_filePath;
+        wxString m_directory;
+        wxStartPageRemoteFilePolicy m_remotePolicy
+            { wxStartPageRemoteFilePolicy::wxProbeRemoteFiles };
+        bool m_deferRemote{ false };
+        ProbeCallback m_onProbed;
+    };
+
+    explicit FileProbePool(wxStartPage* owner) : m_owner(owner) {}
+
+    /// @returns The first queued task whose folder isn't being checked by another worker.
+    /// @note The caller must hold @c m_mutex.
+    std::deque<ProbeTask>::iterator FindRunnableTask()
+    {
+        return std::find_if(m_tasks.begin(), m_tasks.end(),
+            [this](const auto& task)
+            {
+                return std::find(m_busyDirectories.cbegin(), m_busyDirectories.cend(),
+                                 task.m_directory) == m_busyDirectories.cend();
+            });
     }
-    else if (IsFileId(id) || IsFileListClearId(id) || IsBrowseId(id))
+
+    void WorkerLoop()
     {
-        size_t idx = (id == START_PAGE_FILE_LIST_CLEAR || id == START_PAGE_BROWSE_FILE) ?
-            m_fileButtons.size() - 1 :
-            id - ID_FILE_ID_START;
-        if (idx < m_fileButtons.size())
+        while (true)
         {
-            if (id == START_PAGE_FILE_LIST_CLEAR)
+            ProbeTask task;
             {
-                if (wxMessageBox(
-                    _(L"Do you wish to clear the list of recent files?"),
-                    _(L"Clear File List"), wxYES_NO | wxICON_QUESTION) == wxYES)
+                std::unique_lock<std::mutex> lock{ m_mutex };
+                ++m_idleWorkerCount;
+                // (idle threads exit, and are started again as files are queued)
+                const bool taskAvailable = m_taskAvailable.wait_for(lock, PROBE_WORKER_IDLE_TIMEOUT,
+                    [this]() { return m_owner == nullptr || FindRunnableTask() != m_tasks.end(); });
+                --m_idleWorkerCount;
+                if (m_owner == nullptr || !taskAvailable)
+                {
+                    --m_workerCount;
+                    return;
+                }
+                const auto runnableTask = FindRunnableTask();
+                task = std::move(*runnableTask);
+                m_tasks.erase(runnableTask);
+                // a newer list was set after this was queued
+                if (task.m_generation != m_generation)
                 {
-                    SetMRUList(wxArrayString{});
-                    m_activeButton = wxNOT_FOUND;
-                    Refresh();
-                    Update();
-                    wxCommandEvent cevent(wxEVT_STARTPAGE_CLICKED, GetId());
-                    cevent.SetId(START_PAGE_FILE_LIST_CLEAR);
-                    cevent.SetInt(START_PAGE_FILE_LIST_CLEAR);
-                    cevent.SetEventObject(this);
-                    GetEventHandler()->ProcessEvent(cevent);
+                    continue;
                 }
+                m_busyDirectories.push_back(task.m_directory);
             }
-            else if (id == START_PAGE_BROWSE_FILE)
+
+            const TraceSpan span{ "ProbeFile" };
+            const auto start = std::chrono::steady_clock::now();
+            FileProbe probe = ProbeFile(task.m_filePath, task.m_remotePolicy, task.m_deferRemote);
+            probe.m_latency = std::chrono::steady_clock::now() - start;
+            task.m_onProbed(probe);
+
+            // files waiting on this folder can be checked now
             {
-                wxCommandEvent cevent(wxEVT_STARTPAGE_CLICKED, GetId());
-                cevent.SetId(START_PAGE_BROWSE_FILE);
-                cevent.SetInt(START_PAGE_BROWSE_FILE);
-                cevent.SetEventObject(this);
-                GetEventHandler()->ProcessEvent(cevent);
+                const std::lock_guard<std::mutex> lock{ m_mutex };
+                m_busyDirectories.erase(std::find(m_busyDirectories.begin(),
+                                                  m_busyDirectories.end(), task.m_directory));
             }
-            else
+            m_taskAvailable.notify_all();
+        }
+    }
+
+    std::mutex m_mutex;
+    std::condition_variable m_taskAvailable;
+    std::deque<ProbeTask> m_tasks;
+    // the folders that workers are checking a file in
+    std::vector<wxString> m_busyDirectories;
+    wxStartPage* m_owner{ nullptr };
+    size_t m_generation{ 0 };
+    size_t m_workerCount{ 0 };
+    size_t m_idleWorkerCount{ 0 };
+};
+
+/// @brief Collects the results of a batch of probes for a thread
+///     that waits on them (up to a deadline).
+/// @details This is shared with the probe callbacks, so a probe that finishes
+///     after its deadline has passed writes into a waiter that is no longer read.
+class wxStartPage::FileProbeWaiter
+{
+public:
+    explicit FileProbeWaiter(const size_t probeCount) :
+        m_probes(probeCount), m_finished(probeCount, false)
+    {
+    }
+
+    void SetResult(const size_t index, const FileProbe& probe)
+    {
+        {
+            const std::lock_guard<std::mutex> lock{ m_mutex };
+            m_probes[index] = probe;
+            m_finished[index] = true;
+        }
+        m_probeFinished.notify_all();
+    }
+
+    /// @returns @c true if the probe finished before the deadline.
+    /// @param index The probe to wait on.
+    /// @param deadline When to give up on the probe.
+    /// @param[out] probe The result of the probe.
+    bool WaitFor(const size_t index, const std::chrono::steady_clock::time_point deadline,
+                 FileProbe& probe)
+    {
+        std::unique_lock<std::mutex> lock{ m_mutex };
+        if (!m_probeFinished.wait_until(lock, deadline,
+                [this, index]() { return static_cast<bool>(m_finished[index]); }))
+        {
+            return false;
+        }
+        probe = m_probes[index];
+        return true;
+    }
+
+private:
+    std::mutex m_mutex;
+    std::condition_variable m_probeFinished;
+    std::vector<FileProbe> m_probes;
+    std::vector<bool> m_finished;
+};
+
+/// @brief A trigram index over the paths of the files in the MRU list,
+///     for the search box.
+/// @details Paths are stored lowercased and UTF-8 encoded, and each three-byte
+///     sequence in a path maps to the (sorted) IDs of the paths containing it.
+///     A search only checks the paths that contain every trigram of the search text,
+///     rather than every path in the list.\n
+///     A removed path is taken out of its trigrams' IDs, but its ID isn't reused
+///     (so that the IDs stay sorted); the index is rebuilt whenever a new list is set,
+///     or once most of its IDs are for removed paths.
+class wxStartPage::FileFilterIndex
+{
+public:
+    /// @brief Indexes a path.
+    /// @returns The path's ID (IDs increase with each path added).
+    uint32_t Add(const wxString& filePath)
+    {
+        const auto id = static_cast<uint32_t>(m_paths.size());
+        m_paths.push_back(MakeKey(filePath));
+        const std::string& path = m_paths.back();
+        for (size_t i = 0; i + TRIGRAM_LENGTH <= path.length(); ++i)
+        {
+            auto& ids = m_trigrams[GetTrigram(path, i)];
+            // a trigram that appears more than once in a path is only recorded once
+            if (ids.empty() || ids.back() != id)
             {
-                wxCommandEvent cevent(wxEVT_STARTPAGE_CLICKED, GetId());
-                cevent.SetId(m_fileButtons[idx].m_id);
-                cevent.SetInt(m_fileButtons[idx].m_id);
-                cevent.SetString(m_fileButtons[idx].m_fullFilePath);
-                cevent.SetEventObject(this);
-                GetEventHandler()->ProcessEvent(cevent);
+                ids.push_back(id);
             }
         }
+        return id;
+    }
+
+    /// @brief Removes a path from the index.
+    /// @param id The path's ID.
+    void Remove(const uint32_t id)
+    {
+        if (id >= m_paths.size() || m_paths[id].empty())
+        {
+            return;
+        }
+        const std::string& path = m_paths[id];
+        for (size_t i = 0; i + TRIGRAM_LENGTH <= path.length(); ++i)
+        {
+            const auto ids = m_trigrams.find(GetTrigram(path, i));
+            if (ids == m_trigrams.end())
+            {
+                continue;
+            }
+            // (already removed if the trigram appears more than once in the path)
+            const auto position = std::lower_bound(ids->second.begin(), ids->second.end(), id);
+            if (position != ids->second.end() && *position == id)
+            {
+                ids->second.erase(position);
+                if (ids->second.empty())
+                {
+                    m_trigrams.erase(ids);
+                }
+            }
+        }
+        // an empty path never matches (the search text isn't empty when filtering)
+        m_paths[id] = std::string{};
+        ++m_removedCount;
+    }
+
+    /// @returns The number of paths that have been indexed
+    ///     (including removed ones, which still have IDs).
+    [[nodiscard]]
+    size_t GetSize() const noexcept
+    {
+        return m_paths.size();
+    }
+
+    /// @returns @c true if most of the IDs are for removed paths,
+    ///     so the index should be rebuilt.
+    [[nodiscard]]
+    bool IsMostlyRemoved() const noexcept
+    {
+        return m_removedCount >= MIN_REMOVED_TO_REBUILD &&
+            m_removedCount > m_paths.size() - m_removedCount;
+    }
+
+    /// @returns @c true if a path contains the search text.
+    /// @param id The path's ID.
+    /// @param key The search text, from MakeKey().
+    [[nodiscard]]
+    bool Matches(const uint32_t id, const std::string& key) const
+    {
+        return m_paths[id].find(key) != std::string::npos;
+    }
+
+    /// @returns The IDs (sorted) of the paths that contain the search text.
+    /// @param key The search text, from MakeKey().
+    /// @param candidates If not null, only these paths (sorted) are checked.
+    ///     Pass the previous results when the search text was added to,
+    ///     since nothing else can match.
+    [[nodiscard]]
+    std::vector<uint32_t> Find(const std::string& key,
+                               const std::vector<uint32_t>* candidates) const
+    {
+        std::vector<uint32_t> matches;
+        if (candidates != nullptr)
+        {
+            std::copy_if(candidates->cbegin(), candidates->cend(), std::back_inserter(matches),
+                [this, &key](const auto id) { return Matches(id, key); });
+            return matches;
+        }
+        // too short for the trigrams to help, so check everything
+        if (key.length() < TRIGRAM_LENGTH)
+        {
+            for (uint32_t id = 0; id < m_paths.size(); ++id)
+            {
+                if (Matches(id, key))
+                {
+                    matches.push_back(id);
+                }
+            }
+            return matches;
+        }
+
+        // intersect the paths containing each of the search text's trigrams,
+        // starting with the rarest one
+        std::vector<const std::vector<uint32_t>*> trigramIds;
+        for (size_t i = 0; i + TRIGRAM_LENGTH <= key.length(); ++i)
+        {
+            const auto ids = m_trigrams.find(GetTrigram(key, i));
+            if (ids == m_trigrams.cend())
+            {
+                return matches;
+            }
+            trigramIds.push_back(&ids->second);
+        }
+        std::sort(trigramIds.begin(), trigramIds.end(),
+            [](const auto* lhv, const auto* rhv) { return lhv->size() < rhv->size(); });
+        std::vector<uint32_t> intersection{ *trigramIds.front() };
+        std::vector<uint32_t> nextIntersection;
+        for (size_t i = 1; i < trigramIds.size() && !intersection.empty(); ++i)
+        {
+            nextIntersection.clear();
+            std::set_intersection(intersection.cbegin(), intersection.cend(),
+                                  trigramIds[i]->cbegin(), trigramIds[i]->cend(),
+                                  std::back_inserter(nextIntersection));
+            intersection.swap(nextIntersection);
+        }
+        // having all the trigrams doesn't mean they are in the same order
+        return Find(key, &intersection);
+    }
+
+    /// @returns Text (a path or search text) the way that the index stores it.
+    [[nodiscard]]
+    static std::string MakeKey(const wxString& text)
+    {
+        return text.Lower().utf8_string();
+    }
+
+private:
+    static constexpr size_t TRIGRAM_LENGTH = 3;
+    // (rebuilding a small index for every few removed files isn't worth it)
+    static constexpr size_t MIN_REMOVED_TO_REBUILD = 64;
+
+    [[nodiscard]]
+    static uint32_t GetTrigram(const std::string& text, const size_t pos) noexcept
+    {
+        return (static_cast<uint32_t>(static_cast<unsigned char>(text[pos])) << 16) |
+            (static_cast<uint32_t>(static_cast<unsigned char>(text[pos + 1])) << 8) |
+            static_cast<uint32_t>(static_cast<unsigned char>(text[pos + 2]));
+    }
+
+    std::vector<std::string> m_paths;
+    std::unordered_map<uint32_t, std::vector<uint32_t>> m_trigrams;
+    size_t m_removedCount{ 0 };
+};
+
+/// @brief Stock art (rasterized at the sizes it was drawn at) and the resolved
+///     standard user folders, shared by every start page in the application
+///     (e.g., one in each empty tab of an MDI application).
+/// @details Art is reference counted by the bundles drawing it. Art that no start
+///     page is using is kept (for the next start page) until the cache goes over
+///     @c MAX_ART_BYTES, oldest first, and everything is let go once the last
+///     start page is destroyed.\n
+///     This is thread safe, although the art itself is only rasterized on the UI thread.
+class wxStartPage::SharedArtCache
+{
+public:
+    /// @brief Stock art at a size (in pixels, so this includes the content scale).
+    struct ArtKey
+    {
+        wxArtID m_artId;
+        wxArtClient m_client;
+        wxSize m_size;
+
+        bool operator<(const ArtKey& that) const
+        {
+            return std::tie(m_artId, m_client, m_size.x, m_size.y) <
+                std::tie(that.m_artId, that.m_client, that.m_size.x, that.m_size.y);
+        }
+    };
+
+    /// @note This is never destroyed (it is empty once the last start page is).
+    static SharedArtCache& Get()
+    {
+        static auto* cache = new SharedArtCache;
+        return *cache;
+    }
+
+    SharedArtCache(const SharedArtCache&) = delete;
+    SharedArtCache& operator=(const SharedArtCache&) = delete;
+
+    void AddClient()
+    {
+        const std::lock_guard<std::mutex> lock{ m_mutex };
+        ++m_clientCount;
+    }
+
+    void RemoveClient()
+    {
+        const std::lock_guard<std::mutex> lock{ m_mutex };
+        if (m_clientCount > 0 && --m_clientCount == 0)
+        {
+            m_userFolders.reset();
+            while (!m_unusedArt.empty())
+            {
+                EvictOldestUnused();
+            }
+        }
+    }
+
+    /// @returns The art, rasterizing it if no start page has yet.
+    /// @note The caller holds a reference to it until it calls ReleaseArt()
+    ///     (unless the art provider doesn't have it, in which case
+    ///     an invalid bitmap is returned and nothing is cached).
+    wxBitmap AcquireArt(const ArtKey& key)
+    {
+        {
+            const std::lock_guard<std::mutex> lock{ m_mutex };
+            if (const auto entry = m_art.find(key); entry != m_art.end())
+            {
+                return UseEntry(entry);
+            }
+        }
+
+        // rasterize it without holding up other start pages (or threads) using the cache
+        wxBitmap bitmap{ wxArtProvider::GetBitmap(key.m_artId, key.m_client, key.m_size) };
+        if (!bitmap.IsOk())
+        {
+            return bitmap;
+        }
+        // (some providers only have certain sizes)
+        if (bitmap.GetSize() != key.m_size)
+        {
+            wxBitmap::Rescale(bitmap, key.m_size);
+        }
+
+        const std::lock_guard<std::mutex> lock{ m_mutex };
+        // another start page rasterized it in the meantime, so share that one
+        if (const auto entry = m_art.find(key); entry != m_art.end())
+        {
+            return UseEntry(entry);
+        }
+        const size_t bytes{ static_cast<size_t>(bitmap.GetWidth()) *
+                            static_cast<size_t>(bitmap.GetHeight()) * 4 };
+        const auto entry =
+            m_art.emplace(key, ArtEntry{ bitmap, bytes, 0, m_unusedArt.end() }).first;
+        m_artBytes += bytes;
+        return UseEntry(entry);
+    }
+
+    void ReleaseArt(const ArtKey& key)
+    {
+        const std::lock_guard<std::mutex> lock{ m_mutex };
+        const auto entry = m_art.find(key);
+        if (entry == m_art.end() || entry->second.m_users == 0 || --entry->second.m_users > 0)
+        {
+            return;
+        }
+        // keep it for the next start page (if there is still one open)
+        entry->second.m_unusedPosition = m_unusedArt.insert(m_unusedArt.end(), key);
+        if (m_clientCount == 0)
+        {
+            while (!m_unusedArt.empty())
+            {
+                EvictOldestUnused();
+            }
+        }
+        TrimUnused();
+    }
+
+    /// @returns The standard user folders that paths are shortened to,
+    ///     longest first (resolving them if no start page has yet).
+    /// @param reload @c true to resolve them again (e.g., if the user moved them).
+    std::shared_ptr<const std::vector<UserFolderPrefix>> GetUserFolders(const bool reload)
+    {
+        const std::lock_guard<std::mutex> lock{ m_mutex };
+        if (m_userFolders == nullptr || reload)
+        {
+            m_userFolders = std::make_shared<const std::vector<UserFolderPrefix>>(
+                LoadUserFolders());
+        }
+        return m_userFolders;
+    }
+
+private:
+    SharedArtCache() = default;
+
+    // art that isn't being drawn is let go (oldest first) once there is more than this
+    constexpr static size_t MAX_ART_BYTES{ 4 * 1024 * 1024 };
+
+    struct ArtEntry
+    {
+        wxBitmap m_bitmap;
+        size_t m_bytes{ 0 };
+        // how many bundles are drawing it
+        size_t m_users{ 0 };
+        // where it is in m_unusedArt (if nothing is using it)
+        std::list<ArtKey>::iterator m_unusedPosition;
+    };
+
+    static std::vector<UserFolderPrefix> LoadUserFolders()
+    {
+        const std::array<std::pair<wxStandardPathsBase::Dir, wxString>, 6> userFolders{
+            std::make_pair(wxStandardPathsBase::Dir::Dir_Documents, _(L"Documents")),
+            std::make_pair(wxStandardPathsBase::Dir::Dir_Desktop, _(L"Desktop")),
+            std::make_pair(wxStandardPathsBase::Dir::Dir_Pictures, _(L"Pictures")),
+            std::make_pair(wxStandardPathsBase::Dir::Dir_Videos, _(L"Videos")),
+            std::make_pair(wxStandardPathsBase::Dir::Dir_Music, _(L"Music")),
+            std::make_pair(wxStandardPathsBase::Dir::Dir_Downloads, _(L"Downloads"))
+        };
+
+        std::vector<UserFolderPrefix> prefixes;
+        for (const auto& [userDir, label] : userFolders)
+        {
+            wxString folderPath = wxStandardPaths::Get().GetUserDir(userDir);
+            while (folderPath.length() > 1 && wxFileName::IsPathSeparator(folderPath.Last()))
+            {
+                folderPath.RemoveLast();
+            }
+            if (!folderPath.empty())
+            {
+                prefixes.push_back(UserFolderPrefix{ folderPath, label });
+            }
+        }
+        std::stable_sort(prefixes.begin(), prefixes.end(),
+            [](const auto& lhv, const auto& rhv) { return lhv.m_path.length() > rhv.m_path.length(); });
+        return prefixes;
+    }
+
+    void TrimUnused()
+    {
+        while (m_artBytes > MAX_ART_BYTES && !m_unusedArt.empty())
+        {
+            EvictOldestUnused();
+        }
+    }
+
+    void EvictOldestUnused()
+    {
+        const auto entry = m_art.find(m_unusedArt.front());
+        m_unusedArt.pop_front();
+        if (entry != m_art.end())
+        {
+            m_artBytes -= entry->second.m_bytes;
+            m_art.erase(entry);
+        }
+    }
+
+    /// @returns The cached art, with another reference to it.
+    /// @note The caller must hold @c m_mutex.
+    wxBitmap UseEntry(const std::map<ArtKey, ArtEntry>::iterator entry)
+    {
+        if (entry->second.m_users == 0 && entry->second.m_unusedPosition != m_unusedArt.end())
+        {
+            m_unusedArt.erase(entry->second.m_unusedPosition);
+            entry->second.m_unusedPosition = m_unusedArt.end();
+        }
+        ++entry->second.m_users;
+        const wxBitmap bitmap{ entry->second.m_bitmap };
+        TrimUnused();
+        return bitmap;
+    }
+
+    std::mutex m_mutex;
+    std::map<ArtKey, ArtEntry> m_art;
+    // art that nothing is drawing, least recently used first
+    std::list<ArtKey> m_unusedArt;
+    size_t m_artBytes{ 0 };
+    size_t m_clientCount{ 0 };
+    std::shared_ptr<const std::vector<UserFolderPrefix>> m_userFolders;
+};
+
+/// @brief Stock art that is only rasterized at the size that is asked for.
+/// @details wxBitmapBundle::FromBitmaps() needs every size up front, most of which
+///     are never shown. The start page draws each icon at one size at a time,
+///     so this only holds (a reference to) the last size requested,
+///     which comes from the shared art cache.
+class wxStartPage::ArtBundleImpl final : public wxBitmapBundleImpl
+{
+public:
+    ArtBundleImpl(wxArtID artId, wxArtClient client) :
+        m_key{ std::move(artId), std::move(client), wxDefaultSize }
+    {
+    }
+
+    ArtBundleImpl(const ArtBundleImpl&) = delete;
+    ArtBundleImpl& operator=(const ArtBundleImpl&) = delete;
+
+    ~ArtBundleImpl() override
+    {
+        if (m_bitmap.IsOk())
+        {
+            m_bitmap = wxBitmap{};
+            SharedArtCache::Get().ReleaseArt(m_key);
+        }
+    }
+
+    wxSize GetDefaultSize() const override
+    {
+        return wxSize{ 16, 16 };
+    }
+
+    // any size can be asked for, so there is no need to pick one of a few
+    wxSize GetPreferredBitmapSizeAtScale(const double scale) const override
+    {
+        return wxSize{ wxRound(GetDefaultSize().GetWidth() * scale),
+                       wxRound(GetDefaultSize().GetHeight() * scale) };
+    }
+
+    wxBitmap GetBitmap(const wxSize& size) override
+    {
+        if (!m_bitmap.IsOk() || m_key.m_size != size)
+        {
+            SharedArtCache& cache = SharedArtCache::Get();
+            if (m_bitmap.IsOk())
+            {
+                m_bitmap = wxBitmap{};
+                cache.ReleaseArt(m_key);
+            }
+            m_key.m_size = size;
+            // (a reference is only held if a valid bitmap comes back)
+            m_bitmap = cache.AcquireArt(m_key);
+        }
+        return m_bitmap;
+    }
+
+private:
+    SharedArtCache::ArtKey m_key;
+    wxBitmap m_bitmap;
+};
+
+//-------------------------------------------
+wxStartPage::wxStartPage(wxWindow* parent, wxWindowID id /*= wxID_ANY*/,
+    const wxArrayString& mruFiles /*= wxArrayString{}*/,
+    const wxBitmapBundle& logo /*= wxBitmapBundle{}*/,
+    wxString productDescription /*= wxString{}*/)
+    : wxWindow(parent, id, wxDefaultPosition, wxDefaultSize,
+        wxFULL_REPAINT_ON_RESIZE | wxWANTS_CHARS, L"wxStartPage"),
+    m_logo(logo),
+    m_productDescription(std::move(productDescription))
+{
+    // (the stock art and user folders are shared with any other start pages)
+    SharedArtCache::Get().AddClient();
+    // Size of an icon scaled to 32x32, with label padding above and below it.
+    // Note that Realise will adjust this later more intelligently.
+    m_buttonHeight = GetButtonSize().GetHeight() + (2 * GetLabelPaddingHeight());
+    m_buttonWidth = FromDIP(wxSize(200, 200)).GetWidth();
+    // diagnosing a slow start page in the field
+    m_statsEnabled = wxLog::IsAllowedTraceMask(STATS_TRACE_MASK);
+    BuildPageFonts();
+
+    wxWindow::SetBackgroundStyle(wxBG_STYLE_CUSTOM);
+    SetMRUList(mruFiles);
+
+    if (wxSystemSettings::GetAppearance().IsDark())
+    {
+        SetButtonAreaBackgroundColor(wxColour(46, 46, 46));
+        SetMRUBackgroundColor(wxColour(31, 31, 31));
+    }
+
+    SetCanFocus(true);
+
+    Bind(wxEVT_PAINT, &wxStartPage::OnPaintWindow, this);
+    Bind(wxEVT_MOTION, &wxStartPage::OnMouseChange, this);
+    Bind(wxEVT_LEFT_DOWN, &wxStartPage::OnMouseClick, this);
+    Bind(wxEVT_LEAVE_WINDOW, &wxStartPage::OnMouseLeave, this);
+    Bind(wxEVT_MOUSEWHEEL, &wxStartPage::OnMouseWheel, this);
+    Bind(wxEVT_SIZE, &wxStartPage::OnResize, this);
+    Bind(wxEVT_DPI_CHANGED, &wxStartPage::OnDPIChanged, this);
+    Bind(wxEVT_KEY_DOWN, &wxStartPage::OnKeyDown, this);
+    Bind(wxEVT_SET_FOCUS, &wxStartPage::OnSetFocus, this);
+    Bind(wxEVT_KILL_FOCUS, &wxStartPage::OnKillFocus, this);
+    m_probeDeadlineTimer.Bind(wxEVT_TIMER, &wxStartPage::OnProbeDeadline, this);
+    m_timeLabelTimer.Bind(wxEVT_TIMER, &wxStartPage::OnTimeLabelsExpired, this);
+    m_resizeSettleTimer.Bind(wxEVT_TIMER, &wxStartPage::OnResizeSettled, this);
+#if wxUSE_FSWATCHER
+    Bind(wxEVT_FSWATCHER, &wxStartPage::OnFileSystemChange, this);
+#endif
+}
+
+//---------------------------------------------------
+wxStartPage::~wxStartPage()
+{
+    if (m_statsEnabled)
+    {
+        LogStats();
+    }
+    if (!m_fileInfoCachePath.empty())
+    {
+        SaveFileInfoCache();
+    }
+    if (m_probePool != nullptr)
+    {
+        m_probePool->Shutdown();
+    }
+    // (the art that this page's buttons hold is released after this, as they are destroyed)
+    SharedArtCache::Get().RemoveClient();
+}
+
+//---------------------------------------------------
+void wxStartPage::OnSetFocus(wxFocusEvent& event)
+{
+    if (!m_buttons.empty())
+    {
+        m_activeButton = m_buttons[0].m_id;
+    }
+    else if (GetFileRowCount() > 0)
+    {
+        m_activeButton = GetFileRowId(GetVisibleFileRows().first);
+    }
+    else if (m_fileListButton.IsOk())
+    {
+        m_activeButton = m_fileListButton.m_id;
+    }
+    Refresh();
+    event.Skip();
+}
+
+//---------------------------------------------------
+void wxStartPage::OnKillFocus(wxFocusEvent& event)
+{
+    m_activeButton = wxNOT_FOUND;
+    Refresh();
+    event.Skip();
+}
+
+//---------------------------------------------------
+void wxStartPage::OnKeyDown(wxKeyEvent& event)
+{
+    const int keyCode = event.GetKeyCode();
+    const bool inFileList{ IsFileId(m_activeButton) || IsFileListButtonId(m_activeButton) };
+    if (keyCode == WXK_UP)
+    {
+        if (m_activeButton == wxNOT_FOUND)
+        {
+            if (!m_buttons.empty())
+            {
+                m_activeButton = m_buttons[0].m_id;
+            }
+        }
+        else if (IsCustomButtonId(m_activeButton))
+        {
+            size_t idx = m_activeButton - ID_BUTTON_ID_START;
+            if (idx == 0)
+            {
+                idx = m_buttons.size() - 1;
+            }
+            else
+            {
+                --idx;
+            }
+            m_activeButton = m_buttons[idx].m_id;
+        }
+        else if (inFileList)
+        {
+            MoveFileListFocus(-1, true);
+        }
+        Refresh();
+    }
+    else if (keyCode == WXK_DOWN)
+    {
+        if (m_activeButton == wxNOT_FOUND)
+        {
+            if (!m_buttons.empty())
+            {
+                m_activeButton = m_buttons[0].m_id;
+            }
+        }
+        else if (IsCustomButtonId(m_activeButton))
+        {
+            size_t idx = m_activeButton - ID_BUTTON_ID_START;
+            idx = (idx + 1) % m_buttons.size();
+            m_activeButton = m_buttons[idx].m_id;
+        }
+        else if (inFileList)
+        {
+            MoveFileListFocus(1, true);
+        }
+        Refresh();
+    }
+    else if ((keyCode == WXK_PAGEUP || keyCode == WXK_PAGEDOWN) && inFileList)
+    {
+        const long pageRows{ static_cast<long>(GetFileRowsPerPage()) };
+        MoveFileListFocus(keyCode == WXK_PAGEUP ? -pageRows : pageRows, false);
+        Refresh();
+    }
+    else if ((keyCode == WXK_HOME || keyCode == WXK_END) && inFileList)
+    {
+        if (GetFileRowCount() > 0)
+        {
+            const size_t row{ keyCode == WXK_HOME ? 0 : GetFileRowCount() - 1 };
+            m_activeButton = GetFileRowId(row);
+            EnsureFileRowVisible(row);
+            Refresh();
+        }
+    }
+    else if (keyCode == WXK_LEFT)
+    {
+        if (inFileList && !m_buttons.empty())
+        {
+            m_activeButton = m_buttons[0].m_id;
+            Refresh();
+        }
+    }
+    else if (keyCode == WXK_RIGHT)
+    {
+        if (IsCustomButtonId(m_activeButton))
+        {
+            if (GetFileRowCount() > 0)
+            {
+                m_activeButton = GetFileRowId(GetVisibleFileRows().first);
+            }
+            else if (m_fileListButton.IsOk())
+            {
+                m_activeButton = m_fileListButton.m_id;
+            }
+            Refresh();
+        }
+    }
+    else if (keyCode == WXK_RETURN || keyCode == WXK_NUMPAD_ENTER || keyCode == WXK_SPACE)
+    {
+        ActivateButton(m_activeButton);
+    }
+    else
+    {
+        event.Skip();
+    }
+}
+
+//---------------------------------------------------
+void wxStartPage::MoveFileListFocus(const long offset, const bool wrap)
+{
+    // the rows, then the button under them
+    const long itemCount{ static_cast<long>(GetFileRowCount()) + 1 };
+    long item = (IsFileId(m_activeButton) && GetFileRow(m_activeButton) < GetFileRowCount()) ?
+        static_cast<long>(GetFileRow(m_activeButton)) :
+        itemCount - 1;
+    item += offset;
+    item = wrap ?
+        ((item % itemCount) + itemCount) % itemCount :
+        std::clamp(item, 0L, itemCount - 1);
+
+    if (item < itemCount - 1)
+    {
+        m_activeButton = GetFileRowId(static_cast<size_t>(item));
+        EnsureFileRowVisible(static_cast<size_t>(item));
+    }
+    else
+    {
+        m_activeButton = m_fileListButton.m_id;
+    }
+}
+
+//---------------------------------------------------
+void wxStartPage::ActivateButton(wxWindowID id)
+{
+    if (id == wxNOT_FOUND)
+    {
+        return;
+    }
+
+    // (includes the client's handling of the event)
+    const TraceSpan span{ "ActivateButton" };
+    if (IsCustomButtonId(id))
+    {
+        wxCommandEvent cevent(wxEVT_STARTPAGE_CLICKED, GetId());
+        cevent.SetId(id);
+        cevent.SetInt(id);
+        cevent.SetEventObject(this);
+        GetEventHandler()->ProcessEvent(cevent);
+    }
+    else if (IsFileListClearId(id))
+    {
+        if (wxMessageBox(
+            _(L"Do you wish to clear the list of recent files?"),
+            _(L"Clear File List"), wxYES_NO | wxICON_QUESTION) == wxYES)
+        {
+            SetMRUList(wxArrayString{});
+            m_activeButton = wxNOT_FOUND;
+            Refresh();
+            Update();
+            wxCommandEvent cevent(wxEVT_STARTPAGE_CLICKED, GetId());
+            cevent.SetId(START_PAGE_FILE_LIST_CLEAR);
+            cevent.SetInt(START_PAGE_FILE_LIST_CLEAR);
+            cevent.SetEventObject(this);
+            GetEventHandler()->ProcessEvent(cevent);
+        }
+    }
+    else if (IsBrowseId(id))
+    {
+        wxCommandEvent cevent(wxEVT_STARTPAGE_CLICKED, GetId());
+        cevent.SetId(START_PAGE_BROWSE_FILE);
+        cevent.SetInt(START_PAGE_BROWSE_FILE);
+        cevent.SetEventObject(this);
+        GetEventHandler()->ProcessEvent(cevent);
+    }
+    else if (IsFileId(id) && GetFileRow(id) < GetFileRowCount())
+    {
+        wxCommandEvent cevent(wxEVT_STARTPAGE_CLICKED, GetId());
+        cevent.SetId(id);
+        cevent.SetInt(id);
+        cevent.SetString(m_fileButtons[GetFileRowEntry(GetFileRow(id))].m_fullFilePath);
+        cevent.SetEventObject(this);
+        GetEventHandler()->ProcessEvent(cevent);
+    }
+}
+
+//---------------------------------------------------
+void wxStartPage::DrawHighlight(wxDC& dc, const wxRect& rect,
+    const wxColour& color) const
+{
+    const wxDCPenChanger pc{ dc, wxColour{ 211, 211, 211 } };
+    if (m_style == wxStartPageStyle::wxStartPage3D)
+    {
+        // fill with the color
+        dc.GradientFillLinear(rect, color, color.ChangeLightness(140), wxSOUTH);
+        // create a shiny overlay
+        dc.GradientFillLinear(wxRect(rect.GetX(), rect.GetY(),
+            rect.GetWidth(), rect.GetHeight() * 0.25),
+            GetOverlayColor(wxColour(255, 255, 255, 25), color),
+            GetOverlayColor(wxColour(255, 255, 255, 125), color), wxSOUTH);
+        dc.DrawLine(rect.GetLeftTop(), rect.GetRightTop());
+        dc.DrawLine(rect.GetRightTop(), rect.GetRightBottom());
+        dc.DrawLine(rect.GetRightBottom(), rect.GetLeftBottom());
+        dc.DrawLine(rect.GetLeftBottom(), rect.GetLeftTop());
+    }
+    else
+    {
+        const wxDCBrushChanger bc(dc, color);
+        dc.DrawRectangle(rect);
+    }
+}
+
+//---------------------------------------------------
+bool wxStartPage::IsUsingGCDC() const noexcept
+{
+    if (m_renderer != wxStartPageRenderer::wxStartPageDefaultRenderer)
+    {
+        return m_renderer == wxStartPageRenderer::wxStartPageGCDCRenderer;
+    }
+#if defined(__WXGTK3__) || defined(__WXOSX__)
+    // the DC already draws with Cairo (or Core Graphics)
+    return false;
+#else
+    return true;
+#endif
+}
+
+//---------------------------------------------------
+wxColour wxStartPage::GetOverlayColor(const wxColour& color, const wxColour& background) const
+{
+#if defined(__WXGTK3__) || defined(__WXOSX__)
+    const bool canBlend{ true };
+#else
+    const bool canBlend{ IsUsingGCDC() };
+#endif
+    if (canBlend || color.Alpha() == wxALPHA_OPAQUE)
+    {
+        return color;
+    }
+    const double alpha{ color.Alpha() / 255.0 };
+    return wxColour{ wxColour::AlphaBlend(color.Red(), background.Red(), alpha),
+                     wxColour::AlphaBlend(color.Green(), background.Green(), alpha),
+                     wxColour::AlphaBlend(color.Blue(), background.Blue(), alpha) };
+}
+
+//---------------------------------------------------
+void wxStartPage::SetRenderer(const wxStartPageRenderer renderer)
+{
+    if (renderer == m_renderer)
+    {
+        return;
+    }
+    m_renderer = renderer;
+    // text can measure differently through a wxGCDC
+    for (auto& textExtents : m_textExtents)
+    {
+        textExtents.clear();
+    }
+    InvalidateLayout(LAYOUT_ALL);
+    m_backdropDirty = true;
+    SendSizeEvent();
+    Refresh();
+}
+
+//---------------------------------------------------
+void wxStartPage::BuildPageFonts()
+{
+    const wxFont normalFont{ GetFont() };
+    const auto setPageFont = [this](const PageFont font, const wxFont& pageFont)
+        { m_pageFonts[static_cast<size_t>(font)] = pageFont; };
+    setPageFont(PageFont::Normal, normalFont);
+    setPageFont(PageFont::Larger, normalFont.Larger());
+    setPageFont(PageFont::Largest, normalFont.Larger().Larger());
+    setPageFont(PageFont::Greeting, normalFont.Larger().Larger().Bold());
+    setPageFont(PageFont::Logo,
+        wxFont{ wxFontInfo(wxSystemSettings::GetFont(wxSYS_DEFAULT_GUI_FONT).
+                           GetFractionalPointSize() * 1.5) });
+
+    for (auto& textExtents : m_textExtents)
+    {
+        textExtents.clear();
+    }
+    m_backdropDirty = true;
+}
+
+//---------------------------------------------------
+wxSize wxStartPage::MeasureText(wxDC& dc, const PageFont font, const wxString& text)
+{
+    auto& textExtents = m_textExtents[static_cast<size_t>(font)];
+    const auto textExtent = textExtents.find(text);
+    CountCacheLookup(m_stats.m_textExtentCache, textExtent != textExtents.cend());
+    if (textExtent != textExtents.cend())
+    {
+        return textExtent->second;
+    }
+
+    if (textExtents.size() >= MAX_CACHED_TEXT_EXTENTS)
+    {
+        textExtents.clear();
+    }
+    const wxDCFontChanger fc(dc, GetPageFont(font));
+    return textExtents.emplace(text, dc.GetTextExtent(text)).first->second;
+}
+
+//---------------------------------------------------
+void wxStartPage::DrawPageLabel(wxDC& dc, const PageFont font, const wxString& text,
+                                const wxBitmap& bitmap, const wxRect& rect,
+                                const int alignment /*= wxALIGN_LEFT | wxALIGN_TOP*/,
+                                const bool hasMnemonic /*= false*/)
+{
+    size_t mnemonicIndex{ wxString::npos };
+    wxString strippedText;
+    if (hasMnemonic)
+    {
+        strippedText = StripMnemonic(text, &mnemonicIndex);
+    }
+    const wxString& label = hasMnemonic ? strippedText : text;
+
+    const wxSize textSize{ MeasureText(dc, font, label) };
+    const wxSize labelSize = bitmap.IsOk() ?
+        wxSize{ textSize.GetWidth() + bitmap.GetLogicalWidth(), bitmap.GetLogicalHeight() } :
+        textSize;
+
+    wxPoint labelPos{ rect.GetTopLeft() };
+    if ((alignment & wxALIGN_RIGHT) != 0)
+    {
+        labelPos.x = rect.GetRight() - labelSize.GetWidth();
+    }
+    else if ((alignment & wxALIGN_CENTRE_HORIZONTAL) != 0)
+    {
+        labelPos.x = (rect.GetLeft() + rect.GetRight() + 1 - labelSize.GetWidth()) / 2;
+    }
+    if ((alignment & wxALIGN_BOTTOM) != 0)
+    {
+        labelPos.y = rect.GetBottom() - labelSize.GetHeight();
+    }
+    else if ((alignment & wxALIGN_CENTRE_VERTICAL) != 0)
+    {
+        labelPos.y = (rect.GetTop() + rect.GetBottom() + 1 - labelSize.GetHeight()) / 2;
+    }
+
+    if (bitmap.IsOk())
+    {
+        dc.DrawBitmap(bitmap, labelPos, true);
+        // (the same gap between the image and text that wxDC::DrawLabel() uses)
+        labelPos.x += bitmap.GetLogicalWidth() + 4;
+        labelPos.y += (labelSize.GetHeight() - textSize.GetHeight()) / 2;
+    }
+    const wxDCFontChanger fc(dc, GetPageFont(font));
+    dc.DrawText(label, labelPos);
+
+    // underline the mnemonic, one pixel below the baseline (as wxDC::DrawLabel() does)
+    if (mnemonicIndex != wxString::npos)
+    {
+        wxCoord prefixWidth{ 0 };
+        wxCoord charWidth{ 0 };
+        wxCoord charHeight{ 0 };
+        wxCoord descent{ 0 };
+        dc.GetTextExtent(label.Left(mnemonicIndex), &prefixWidth, &charHeight);
+        dc.GetTextExtent(label.Mid(mnemonicIndex, 1), &charWidth, &charHeight, &descent);
+        const wxCoord underlineY{ labelPos.y + textSize.GetHeight() - descent + 1 };
+        const wxDCPenChanger pc(dc, wxPen{ dc.GetTextForeground() });
+        dc.DrawLine(labelPos.x + prefixWidth, underlineY,
+                    labelPos.x + prefixWidth + charWidth, underlineY);
+    }
+}
+
+//---------------------------------------------------
+wxString wxStartPage::StripMnemonic(const wxString& label, size_t* mnemonicIndex /*= nullptr*/)
+{
+    if (mnemonicIndex != nullptr)
+    {
+        *mnemonicIndex = wxString::npos;
+    }
+    if (label.find(L'&') == wxString::npos)
+    {
+        return label;
+    }
+    wxString strippedLabel;
+    strippedLabel.reserve(label.length());
+    for (size_t i = 0; i < label.length(); ++i)
+    {
+        if (label[i] == L'&')
+        {
+            // "&&" is a literal "&"; otherwise, the next character is the mnemonic
+            // (and a trailing "&" is dropped)
+            if (i + 1 < label.length() && label[i + 1] == L'&')
+            {
+                strippedLabel += L'&';
+                ++i;
+            }
+            else if (i + 1 < label.length() && mnemonicIndex != nullptr &&
+                     *mnemonicIndex == wxString::npos)
+            {
+                *mnemonicIndex = strippedLabel.length();
+            }
+            continue;
+        }
+        strippedLabel += label[i];
+    }
+    return strippedLabel;
+}
+
+//---------------------------------------------------
+wxStartPage::FileProbe wxStartPage::ProbeFile(const wxString& filePath,
+    const wxStartPageRemoteFilePolicy remotePolicy, const bool deferRemote)
+{
+    FileProbe probe{ filePath, FileInfo{}, FileProbeState::Missing };
+
+    // only look up the file system type if remote files are treated differently
+    if (remotePolicy != wxStartPageRemoteFilePolicy::wxProbeRemoteFiles)
+    {
+        probe.m_info.m_remote = IsOnRemoteFileSystem(filePath);
+        if (probe.m_info.m_remote)
+        {
+            if (remotePolicy == wxStartPageRemoteFilePolicy::wxSkipRemoteFiles)
+            {
+                return probe;
+            }
+            if (remotePolicy == wxStartPageRemoteFilePolicy::wxProbeRemoteFilesLazily &&
+                deferRemote)
+            {
+                probe.m_state = FileProbeState::Found;
+                probe.m_info.m_pendingProbe = true;
+                return probe;
+            }
+        }
+    }
+
+    // one stat() call for existence, time, and size (rather than
+    // wxFileName::FileExists() and GetTimes(), which each stat the file)
+    wxStructStat fileStat;
+    const int statError = (wxStat(filePath, &fileStat) == 0) ? 0 : errno;
+    if (statError == 0 && (fileStat.st_mode & S_IFMT) == S_IFREG)
+    {
+        probe.m_state = FileProbeState::Found;
+        probe.m_info.m_exists = true;
+        probe.m_info.m_modTime = wxDateTime{ static_cast<time_t>(fileStat.st_mtime) };
+        probe.m_info.m_size = wxULongLong{ static_cast<wxULongLong_t>(fileStat.st_size) };
+    }
+    // a remote file that is there, but can't be reached right now
+    else if (statError != 0 && statError != ENOENT && statError != ENOTDIR &&
+             probe.m_info.m_remote &&
+             remotePolicy != wxStartPageRemoteFilePolicy::wxProbeRemoteFiles)
+    {
+        probe.m_state = FileProbeState::Found;
+        probe.m_info.m_unavailable = true;
+    }
+    return probe;
+}
+
+//---------------------------------------------------
+wxStartPage::FileProbe wxStartPage::ProbeFileNow(const wxString& filePath,
+    const wxStartPageRemoteFilePolicy remotePolicy, const bool deferRemote)
+{
+    if (m_statsEnabled)
+    {
+        ++m_stats.m_fileProbes;
+    }
+    const auto start = std::chrono::steady_clock::now();
+    FileProbe probe{ filePath, FileInfo{}, FileProbeState::Missing };
+    if (!m_fileInfoSource)
+    {
+        probe = ProbeFile(filePath, remotePolicy, deferRemote);
+    }
+    else
+    {
+        const wxDateTime modTime{ m_fileInfoSource(filePath) };
+        if (modTime.IsValid())
+        {
+            probe.m_state = FileProbeState::Found;
+            probe.m_info.m_exists = true;
+            probe.m_info.m_modTime = modTime;
+        }
+    }
+    probe.m_latency = std::chrono::steady_clock::now() - start;
+    return probe;
+}
+
+//---------------------------------------------------
+wxStartPage::FileProbe wxStartPage::MakeTimedOutProbe(const wxString& filePath) const
+{
+    // a file that doesn't respond is almost certainly on an unresponsive mount,
+    // so treat it as remote
+    FileProbe probe{ filePath, FileInfo{}, FileProbeState::Missing };
+    probe.m_info.m_remote = true;
+    if (m_remoteFilePolicy == wxStartPageRemoteFilePolicy::wxShowUnavailableRemoteFiles ||
+        m_remoteFilePolicy == wxStartPageRemoteFilePolicy::wxProbeRemoteFilesLazily)
+    {
+        probe.m_state = FileProbeState::Found;
+        probe.m_info.m_unavailable = true;
+    }
+    return probe;
+}
+
+//---------------------------------------------------
+void wxStartPage::RecordProbeTimeout(const wxString& filePath)
+{
+    if (m_statsEnabled)
+    {
+        ++m_stats.m_fileProbeTimeouts;
+    }
+    const auto backOff = [](ProbeBackoff& backoff)
+        {
+            auto delay = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                PROBE_BACKOFF_START);
+            for (size_t i = 0; i < backoff.m_timeoutCount && delay < PROBE_BACKOFF_MAX; ++i)
+            {
+                delay *= 2;
+            }
+            ++backoff.m_timeoutCount;
+            backoff.m_retryTime = std::chrono::steady_clock::now() +
+                std::min<std::chrono::steady_clock::duration>(delay, PROBE_BACKOFF_MAX);
+        };
+    backOff(m_probeBackoffs[filePath]);
+    // the rest of the folder is most likely on the same unresponsive mount
+    backOff(m_probeDirectoryBackoffs[GetProbeDirectory(filePath)]);
+}
+
+//---------------------------------------------------
+bool wxStartPage::IsProbeBackingOff(const wxString& filePath) const
+{
+    const auto now = std::chrono::steady_clock::now();
+    const auto isBackingOff = [&now](const std::map<wxString, ProbeBackoff>& backoffs,
+                                     const wxString& path)
+        {
+            const auto backoff = backoffs.find(path);
+            return backoff != backoffs.cend() && now < backoff->second.m_retryTime;
+        };
+    return isBackingOff(m_probeBackoffs, filePath) ||
+        (!m_probeDirectoryBackoffs.empty() &&
+         isBackingOff(m_probeDirectoryBackoffs, GetProbeDirectory(filePath)));
+}
+
+//---------------------------------------------------
+void wxStartPage::ClearProbeBackoff(const wxString& filePath)
+{
+    m_probeBackoffs.erase(filePath);
+    if (!m_probeDirectoryBackoffs.empty())
+    {
+        m_probeDirectoryBackoffs.erase(GetProbeDirectory(filePath));
+    }
+}
+
+//---------------------------------------------------
+void wxStartPage::UpdateFileListButton()
+{
+    if (m_fileButtons.empty())
+    {
+        if (IsBrowseId(m_fileListButton.m_id))
+        {
+            return;
+        }
+        // (reused, so that the size it was rasterized at is kept)
+        if (!m_browseIcon.IsOk())
+        {
+            m_browseIcon = CreateArtBundle(wxART_FOLDER_OPEN);
+        }
+        m_fileListButton = wxStartPageButton{ m_browseIcon, GetBrowseForFileLabel() };
+        m_fileListButton.m_id = START_PAGE_BROWSE_FILE;
+    }
+    else
+    {
+        if (IsFileListClearId(m_fileListButton.m_id))
+        {
+            return;
+        }
+        m_fileListButton = wxStartPageButton{ wxBitmapBundle{}, GetClearFileListLabel() };
+        m_fileListButton.m_id = START_PAGE_FILE_LIST_CLEAR;
+    }
+
+    GetRenderedBitmap(m_fileListButton.m_icon, m_fileListButton.m_renderedIcon, GetButtonSize());
+    InvalidateLayout(LAYOUT_FILE_ROWS);
+
+    // keep the focus on the button if it was swapped out
+    if (IsFileListButtonId(m_activeButton))
+    {
+        m_activeButton = m_fileListButton.m_id;
+    }
+}
+
+//---------------------------------------------------
+void wxStartPage::SetMRUList(const wxArrayString& mruFiles)
+{
+    const StatsTimer timer{ m_statsEnabled, m_stats.m_setMRUList };
+    const TraceSpan span{ "SetMRUList" };
+
+    // the same list that is already loaded, so nothing to do
+    // (the hash rules out most changed lists without comparing them)
+    const size_t mruFilesHash{ HashFileList(mruFiles) };
+    if (m_mruFilesLoaded && mruFilesHash == m_mruFilesHash &&
+        mruFiles.size() == m_mruFiles.size() &&
+        std::equal(mruFiles.begin(), mruFiles.end(), m_mruFiles.begin()))
+    {
+        return;
+    }
+    m_mruFilesLoaded = true;
+    m_mruFilesHash = mruFilesHash;
+
+    // results from probes of the previous list will be ignored
+    ++m_probeGeneration;
+    m_probesInFlight.clear();
+    m_probeDeadlineTimer.Stop();
+    m_mruFiles = mruFiles;
+    m_deletedFiles.clear();
+    m_fileScrollPosition = 0;
+    if (IsFileId(m_activeButton))
+    {
+        m_activeButton = wxNOT_FOUND;
+    }
+    if (m_probePool != nullptr)
+    {
+        m_probePool->SetGeneration(m_probeGeneration);
+    }
+
+    // Show the files from the metadata cache (if there is one) and re-check them
+    // in the background. Otherwise, check the files that fit on the page before
+    // showing the list (unless checking them in the background).
+    // Either way, the rest are checked as they are scrolled into view.
+    std::vector<FileProbe> probes = (mruFiles.IsEmpty() || m_fileInfoSource) ?
+        std::vector<FileProbe>{} : LoadFileInfoCache(mruFiles);
+    const bool fromCache{ !probes.empty() };
+    if (m_fileInfoSource && !mruFiles.IsEmpty())
+    {
+        // the client's metadata source is quick, so check the whole list up front
+        probes = ProbeFilesWithDeadline(mruFiles, mruFiles.size());
+    }
+    else if (!fromCache && !m_asyncFileProbing && !mruFiles.IsEmpty())
+    {
+        probes = ProbeFilesWithDeadline(mruFiles,
+            std::max(INITIAL_FILE_ROWS, GetFileRowsPerPage() + 1));
+    }
+    BuildFileRows(probes);
+    ProbeVisibleRows();
+    if (fromCache)
+    {
+        ProbeCachedMissingFiles(probes);
+    }
+    Refresh();
+}
+
+//---------------------------------------------------
+std::vector<wxStartPage::FileProbe> wxStartPage::ProbeFilesWithDeadline(
+    const wxArrayString& mruFiles, const size_t maxFound)
+{
+    const TraceSpan span{ "ProbeFilesWithDeadline" };
+    std::vector<FileProbe> probes;
+    size_t foundCount{ 0 };
+    // no deadline (or the client's metadata source), just check the files here
+    if (m_probeTimeout.count() <= 0 || m_fileInfoSource)
+    {
+        for (const auto& file : mruFiles)
+        {
+            probes.push_back(ProbeFileNow(file, m_remoteFilePolicy, true));
+            RecordFileProbe(probes.back().m_latency);
+            if (probes.back().m_state == FileProbeState::Found && ++foundCount == maxFound)
+            {
+                break;
+            }
+        }
+        return probes;
+    }
+
+    FileProbePool& pool = GetProbePool();
+
+    // Probe files in batches (as many as are still needed to fill the page) on the
+    // worker pool, all under one deadline, so that a hung mount only holds up the
+    // list once (however many of its files are in it). Whatever isn't checked by
+    // then is shown unchecked and checked in the background.
+    const auto deadline = std::chrono::steady_clock::now() + m_probeTimeout;
+    size_t nextFile{ 0 };
+    while (nextFile < mruFiles.size() && foundCount < maxFound &&
+           std::chrono::steady_clock::now() < deadline)
+    {
+        const size_t batchSize =
+            std::min(maxFound - foundCount, mruFiles.size() - nextFile);
+        auto waiter = std::make_shared<FileProbeWaiter>(batchSize);
+        for (size_t i = 0; i < batchSize; ++i)
+        {
+            const auto& file = mruFiles[nextFile + i];
+            if (IsProbeBackingOff(file))
+            {
+                waiter->SetResult(i, MakeTimedOutProbe(file));
+                continue;
+            }
+            if (m_statsEnabled)
+            {
+                ++m_stats.m_fileProbes;
+            }
+            pool.Submit(m_probeGeneration, file, m_remoteFilePolicy, true,
+                [waiter, i](const FileProbe& probe) { waiter->SetResult(i, probe); });
+        }
+
+        for (size_t i = 0; i < batchSize; ++i)
+        {
+            const auto& file = mruFiles[nextFile + i];
+            FileProbe probe;
+            if (!waiter->WaitFor(i, deadline, probe))
+            {
+                // still queued (e.g., behind a hung file in the same folder),
+                // so it never touched the disk and isn't backed off from
+                if (pool.Cancel(file))
+                {
+                    probe = FileProbe{ file, FileInfo{}, FileProbeState::Pending };
+                }
+                else
+                {
+                    RecordProbeTimeout(file);
+                    probe = MakeTimedOutProbe(file);
+                }
+            }
+            else
+            {
+                RecordFileProbe(probe.m_latency);
+                if (!probe.m_info.m_unavailable)
+                {
+                    ClearProbeBackoff(probe.m_filePath);
+                }
+            }
+            if (probe.m_state == FileProbeState::Found)
+            {
+                ++foundCount;
+            }
+            probes.push_back(std::move(probe));
+        }
+        nextFile += batchSize;
+    }
+    return probes;
+}
+
+//---------------------------------------------------
+void wxStartPage::ProbeVisibleRows()
+{
+    const auto [firstRow, lastRow] = GetVisibleFileRows();
+    if (firstRow == lastRow)
+    {
+        return;
+    }
+
+    FileProbePool* pool{ nullptr };
+    const size_t generation{ m_probeGeneration };
+    for (size_t row = firstRow; row < lastRow; ++row)
+    {
+        const size_t entry{ GetFileRowEntry(row) };
+        auto& fileButton = m_fileButtons[entry];
+        if (fileButton.m_probed)
+        {
+            continue;
+        }
+        fileButton.m_probed = true;
+        // (watched now, since its result won't be seen as newly checked when it comes in)
+        WatchFileRow(fileButton);
+        if (pool == nullptr)
+        {
+            pool = &GetProbePool();
+        }
+
+        // recently timed out, so don't wait on it again yet
+        // (this is posted, since applying it here could remove rows from under the caller)
+        if (IsProbeBackingOff(fileButton.m_fullFilePath))
+        {
+            pool->PostToOwner(generation,
+                [result = FileProbeResult{ generation, entry, fileButton.m_fullFilePath,
+                                           MakeTimedOutProbe(fileButton.m_fullFilePath).m_info }]
+                (wxStartPage& startPage)
+                { startPage.UpdateFileRow(result.m_filePath, result.m_info, result.m_row); });
+            continue;
+        }
+
+        QueueFileProbe(fileButton.m_fullFilePath, entry);
+    }
+}
+
+//---------------------------------------------------
+void wxStartPage::QueueFileProbe(const wxString& filePath, const size_t entryHint)
+{
+    const size_t generation{ m_probeGeneration };
+    // a remote file shown before it was checked will still be shown
+    // (as unavailable) if it can't be reached
+    const auto remotePolicy =
+        (m_remoteFilePolicy == wxStartPageRemoteFilePolicy::wxProbeRemoteFilesLazily) ?
+        wxStartPageRemoteFilePolicy::wxShowUnavailableRemoteFiles :
+        m_remoteFilePolicy;
+
+    m_probesInFlight[filePath] = (m_probeTimeout.count() > 0) ?
+        std::chrono::steady_clock::now() + m_probeTimeout :
+        std::chrono::steady_clock::time_point::max();
+    // the client's metadata source is quick (and may not be thread safe),
+    // so check it here but still deliver the result like a background probe
+    if (m_fileInfoSource)
+    {
+        const FileProbe probe{ ProbeFileNow(filePath, remotePolicy, false) };
+        CallAfter([this, result = FileProbeResult{ generation, entryHint, filePath,
+                                                   probe.m_info, probe.m_latency }]()
+            { OnFileProbed(result); });
+        return;
+    }
+    if (m_statsEnabled)
+    {
+        ++m_stats.m_fileProbes;
+    }
+    FileProbePool& pool = GetProbePool();
+    pool.Submit(generation, filePath, remotePolicy, false,
+        [pool = &pool, generation, entryHint](const FileProbe& probe)
+        {
+            pool->PostToOwner(generation,
+                [result = FileProbeResult{ generation, entryHint, probe.m_filePath,
+                                           probe.m_info, probe.m_latency }]
+                (wxStartPage& startPage) { startPage.OnFileProbed(result); });
+        });
+
+    if (m_probeTimeout.count() > 0 && !m_probeDeadlineTimer.IsRunning())
+    {
+        m_probeDeadlineTimer.Start(static_cast<int>(m_probeTimeout.count()), wxTIMER_ONE_SHOT);
+    }
+}
+
+//---------------------------------------------------
+void wxStartPage::OnProbeDeadline([[maybe_unused]] wxTimerEvent& event)
+{
+    const auto now = std::chrono::steady_clock::now();
+    auto nextDeadline = std::chrono::steady_clock::time_point::max();
+    std::vector<wxString> timedOutFiles;
+    for (auto probe = m_probesInFlight.begin(); probe != m_probesInFlight.end(); /* in loop */)
+    {
+        if (probe->second <= now)
+        {
+            timedOutFiles.push_back(probe->first);
+            probe = m_probesInFlight.erase(probe);
+        }
+        else
+        {
+            nextDeadline = std::min(nextDeadline, probe->second);
+            ++probe;
+        }
+    }
+
+    if (nextDeadline != std::chrono::steady_clock::time_point::max())
+    {
+        const auto waitTime = std::chrono::duration_cast<std::chrono::milliseconds>(
+            nextDeadline - now);
+        m_probeDeadlineTimer.Start(std::max<int>(1, static_cast<int>(waitTime.count())),
+                                   wxTIMER_ONE_SHOT);
+    }
+    bool requeue{ false };
+    for (const auto& filePath : timedOutFiles)
+    {
+        // still queued (e.g., behind a hung file in the same folder), so it never
+        // touched the disk; queue it again (unless its folder is now backed off from)
+        if (m_probePool != nullptr && m_probePool->Cancel(filePath))
+        {
+            const size_t row{ FindFileRow(filePath) };
+            if (row < GetMRUFileCount())
+            {
+                m_fileButtons[row].m_probed = false;
+                requeue = true;
+            }
+            continue;
+        }
+        RecordProbeTimeout(filePath);
+        UpdateFileRow(filePath, MakeTimedOutProbe(filePath).m_info);
+    }
+    if (requeue)
+    {
+        ProbeVisibleRows();
+    }
+}
+
+//---------------------------------------------------
+void wxStartPage::OnFileProbed(const FileProbeResult& result)
+{
+    // a newer list was set after this probe was queued
+    if (result.m_generation != m_probeGeneration)
+    {
+        return;
+    }
+    // already timed out (or removed from the list)
+    const auto probe = m_probesInFlight.find(result.m_filePath);
+    if (probe == m_probesInFlight.end())
+    {
+        return;
+    }
+    m_probesInFlight.erase(probe);
+    if (m_probesInFlight.empty())
+    {
+        m_probeDeadlineTimer.Stop();
+    }
+    if (!result.m_info.m_unavailable)
+    {
+        ClearProbeBackoff(result.m_filePath);
+    }
+    RecordFileProbe(result.m_latency);
+
+    UpdateFileRow(result.m_filePath, result.m_info, result.m_row);
+}
+
+//---------------------------------------------------
+void wxStartPage::SetClock(std::function<wxDateTime()> clock)
+{
+    m_clock = std::move(clock);
+    InvalidateGreeting();
+    for (auto& fileButton : m_fileButtons)
+    {
+        fileButton.m_timeLabelValid = false;
+    }
+    InvalidateLayout(LAYOUT_FILE_ROWS);
+    Refresh();
+}
+
+//---------------------------------------------------
+void wxStartPage::SetFileInfoSource(std::function<wxDateTime(const wxString&)> fileInfoSource)
+{
+    m_fileInfoSource = std::move(fileInfoSource);
+    // check the files again from the new source
+    if (m_mruFilesLoaded)
+    {
+        m_mruFilesLoaded = false;
+        SetMRUList(wxArrayString{ m_mruFiles });
+    }
+}
+
+//---------------------------------------------------
+void wxStartPage::SetFileOrder(const wxStartPageFileOrder order)
+{
+    if (order == m_fileOrder)
+    {
+        return;
+    }
+    m_fileOrder = order;
+    // show the files again in the new order
+    if (m_mruFilesLoaded)
+    {
+        m_mruFilesLoaded = false;
+        SetMRUList(wxArrayString{ m_mruFiles });
+    }
+}
+
+//---------------------------------------------------
+wxString wxStartPage::FormatFileDateTime(const wxDateTime& modTime, const wxDateTime& now,
+                                         wxDateTime& expiration)
+{
+    const wxTimeSpan timeDiff = now.Subtract(modTime);
+    if (timeDiff.GetHours() < 1)
+    {
+        if (timeDiff.GetMinutes() < 10)
+        {
+            expiration = modTime + wxTimeSpan::Minutes(10);
+            return _(L"Just now");
+        }
+        expiration = modTime + wxTimeSpan::Minutes(timeDiff.GetMinutes() + 1);
+        return wxString::Format(_(L"%d minutes ago"), timeDiff.GetMinutes());
+    }
+    if (timeDiff.GetMinutes() < 90)
+    {
+        expiration = modTime + wxTimeSpan::Minutes(90);
+        return _(L"1 hour ago");
+    }
+    if (timeDiff.GetHours() <= 8)
+    {
+        // the hours are rounded, so this changes on the half hour
+        const bool roundUp{ (timeDiff.GetMinutes() - (60 * timeDiff.GetHours())) >= 30 };
+        expiration = modTime + wxTimeSpan::Hours(timeDiff.GetHours()) +
+            wxTimeSpan::Minutes(roundUp ? 60 : 30);
+        return wxString::Format(_(L"%d hours ago"),
+            timeDiff.GetHours() + (roundUp ? 1 : 0));
+    }
+    // named day if modified sometime this week
+    if (now.GetYear() == modTime.GetYear() &&
+        now.GetMonth() == modTime.GetMonth() &&
+        now.GetWeekOfMonth() == modTime.GetWeekOfMonth())
+    {
+        // "Today" becomes "Yesterday" (and so on) at midnight
+        expiration = now.GetDateOnly() + wxDateSpan::Day();
+
+        // include time, in the local clock format
+        wxString am, pm;
+        wxDateTime::GetAmPmStrings(&am, &pm);
+        const wxString timeStr = (!am.empty() && !pm.empty()) ?
+            modTime.Format(L"%I:%M %p").MakeUpper() :
+            modTime.Format(L"%H:%M");
+
+        if (now.GetDay() == modTime.GetDay())
+        {
+            return wxString::Format(_(L"Today at %s"), timeStr);
+        }
+        if (now.GetDay() - 1 == modTime.GetDay())
+        {
+            return wxString::Format(_(L"Yesterday at %s"), timeStr);
+        }
+        return wxString::Format(// TRANSLATORS: DAY at TIME OF DAY
+            _(L"%s at %s"),
+            wxDateTime::GetWeekDayName(modTime.GetWeekDay(),
+                wxDateTime::NameFlags::Name_Abbr),
+            timeStr);
+    }
+
+    // only show year if modified last year
+    // (the label only changes when the week or year does)
+    expiration = now.GetDateOnly() + wxDateSpan::Day();
+    return modTime.Format((now.GetYear() == modTime.GetYear()) ? L"%B %d " : L"%B %d, %Y");
+}
+
+//---------------------------------------------------
+const wxString& wxStartPage::GetFileTimeLabel(wxStartPageButton& fileButton,
+                                              const wxDateTime& now)
+{
+    const bool upToDate{ fileButton.m_timeLabelValid &&
+        (!fileButton.m_timeLabelExpiration.IsValid() ||
+         now < fileButton.m_timeLabelExpiration) };
+    CountCacheLookup(m_stats.m_timeLabelCache, upToDate);
+    if (upToDate)
+    {
+        return fileButton.m_timeLabel;
+    }
+
+    const FileInfo& fileInfo = fileButton.m_fileInfo;
+    fileButton.m_timeLabelExpiration = wxDateTime{};
+    if (fileInfo.m_unavailable)
+    {
+        fileButton.m_timeLabel = GetUnavailableFileLabel();
+    }
+    else if (fileInfo.m_exists && fileInfo.m_modTime.IsValid())
+    {
+        fileButton.m_timeLabel =
+            FormatFileDateTime(fileInfo.m_modTime, now, fileButton.m_timeLabelExpiration);
+    }
+    else
+    {
+        fileButton.m_timeLabel.clear();
+    }
+    fileButton.m_timeLabelValid = true;
+    return fileButton.m_timeLabel;
+}
+
+//---------------------------------------------------
+void wxStartPage::ScheduleTimeLabelRefresh(const wxDateTime& now)
+{
+    // only the labels in view matter; the others are reformatted
+    // when they are scrolled into view
+    wxDateTime nextExpiration;
+    const auto [firstRow, lastRow] = GetVisibleFileRows();
+    for (size_t row = firstRow; row < lastRow; ++row)
+    {
+        const auto& fileButton = m_fileButtons[GetFileRowEntry(row)];
+        if (fileButton.m_timeLabelValid && fileButton.m_timeLabelExpiration.IsValid() &&
+            fileButton.m_timeLabelExpiration > now &&
+            (!nextExpiration.IsValid() || fileButton.m_timeLabelExpiration < nextExpiration))
+        {
+            nextExpiration = fileButton.m_timeLabelExpiration;
+        }
+    }
+
+    if (!nextExpiration.IsValid())
+    {
+        m_timeLabelTimer.Stop();
+        return;
+    }
+    // (checked at least daily, so that the interval fits in the timer)
+    const wxLongLong waitTime = nextExpiration.Subtract(now).GetMilliseconds();
+    m_timeLabelTimer.Start(
+        static_cast<int>(std::clamp<long long>(waitTime.GetValue(), 1, 24LL * 60 * 60 * 1000)),
+        wxTIMER_ONE_SHOT);
+}
+
+//---------------------------------------------------
+void wxStartPage::OnTimeLabelsExpired([[maybe_unused]] wxTimerEvent& event)
+{
+    const wxDateTime now{ GetCurrentTime() };
+    // (measured the same way that the labels are drawn)
+    wxClientDC clientDC(this);
+    std::optional<wxGCDC> gcdc;
+    wxDC& dc = IsUsingGCDC() ? static_cast<wxDC&>(gcdc.emplace(clientDC)) : clientDC;
+    bool widerLabel{ false };
+    std::vector<size_t> expiredRows;
+    const auto [firstRow, lastRow] = GetVisibleFileRows();
+    for (size_t row = firstRow; row < lastRow; ++row)
+    {
+        auto& fileButton = m_fileButtons[GetFileRowEntry(row)];
+        if (fileButton.m_timeLabelValid && fileButton.m_timeLabelExpiration.IsValid() &&
+            now >= fileButton.m_timeLabelExpiration)
+        {
+            expiredRows.push_back(row);
+            // the labels are drawn ragged right, so a wider one moves all of them
+            if (MeasureText(dc, PageFont::Normal,
+                            GetFileTimeLabel(fileButton, now)).GetWidth() > m_timeLabelWidth)
+            {
+                widerLabel = true;
+            }
+        }
+    }
+
+    if (widerLabel)
+    {
+        RefreshFileRows(firstRow, lastRow - 1);
+    }
+    else
+    {
+        for (const auto row : expiredRows)
+        {
+            RefreshFileRows(row, row);
+        }
+    }
+    ScheduleTimeLabelRefresh(now);
+}
+
+//---------------------------------------------------
+void wxStartPage::RefreshUserFolders()
+{
+    m_userFolderPrefixes = SharedArtCache::Get().GetUserFolders(true);
+    // the path labels are rebuilt as the rows are drawn
+    for (auto& fileButton : m_fileButtons)
+    {
+        fileButton.m_label.clear();
+    }
+    InvalidateLayout(LAYOUT_FILE_ROWS);
+    Refresh();
+}
+
+//---------------------------------------------------
+wxString wxStartPage::SimplifyFilePath(const wxString& filePath)
+{
+    if (m_userFolderPrefixes == nullptr)
+    {
+        m_userFolderPrefixes = SharedArtCache::Get().GetUserFolders(false);
+    }
+
+    // the file's folder is everything before the last separator
+    // (keeping the separator if it is the root)
+    size_t pathEnd{ filePath.length() };
+    while (pathEnd > 0 && !wxFileName::IsPathSeparator(filePath[pathEnd - 1]))
+    {
+        --pathEnd;
+    }
+    if (pathEnd > 1)
+    {
+        --pathEnd;
+    }
+
+    // shorten the longest standard user folder that the path is in
+    const bool caseSensitive{ wxFileName::IsCaseSensitive() };
+    const UserFolderPrefix* userFolder{ nullptr };
+    for (const auto& prefix : *m_userFolderPrefixes)
+    {
+        const size_t prefixLength{ prefix.m_path.length() };
+        if (prefixLength > pathEnd ||
+            (prefixLength < pathEnd && !wxFileName::IsPathSeparator(filePath[prefixLength])))
+        {
+            continue;
+        }
+        size_t i{ 0 };
+        while (i < prefixLength &&
+               (caseSensitive ? (filePath[i] == prefix.m_path[i]) :
+                   (wxTolower(filePath[i]) == wxTolower(prefix.m_path[i]))))
+        {
+            ++i;
+        }
+        if (i == prefixLength)
+        {
+            userFolder = &prefix;
+            break;
+        }
+    }
+
+    // replace separators with guillemets (makes it look fancier)
+    constexpr wchar_t separatorLabel[] = L" \u00BB ";
+    constexpr size_t separatorLabelLength{ std::size(separatorLabel) - 1 };
+    const size_t pathStart{ (userFolder != nullptr) ? userFolder->m_path.length() : 0 };
+    size_t separatorCount{ 0 };
+    for (size_t i = pathStart; i < pathEnd; ++i)
+    {
+        if (wxFileName::IsPathSeparator(filePath[i]))
+        {
+            ++separatorCount;
+        }
+    }
+    wxString path;
+    path.reserve(((userFolder != nullptr) ? userFolder->m_label.length() : 0) +
+                 (pathEnd - pathStart) + (separatorCount * (separatorLabelLength - 1)));
+    if (userFolder != nullptr)
+    {
+        path += userFolder->m_label;
+    }
+    for (size_t i = pathStart; i < pathEnd; ++i)
+    {
+        if (wxFileName::IsPathSeparator(filePath[i]))
+        {
+            path += separatorLabel;
+        }
+        else
+        {
+            path += filePath[i];
+        }
+    }
+    return path;
+}
+
+//---------------------------------------------------
+void wxStartPage::BuildFileRows(const std::vector<FileProbe>& probes)
+{
+    const TraceSpan span{ "BuildFileRows" };
+    // the probes are for the files at the top of the client's list (in the client's
+    // order, which SortFileRows() may change afterwards); missing ones are left out,
+    // and the rest (and files that weren't checked) are shown unchecked
+    m_fileButtons.clear();
+    m_fileButtons.reserve(m_mruFiles.size());
+    for (size_t i = 0; i < m_mruFiles.size(); ++i)
+    {
+        wxStartPageButton fileButton;
+        fileButton.m_fullFilePath = m_mruFiles[i];
+        if (i < probes.size() && probes[i].m_state == FileProbeState::Missing)
+        {
+            continue;
+        }
+        if (i < probes.size() && probes[i].m_state != FileProbeState::Pending)
+        {
+            fileButton.m_fileInfo = probes[i].m_info;
+            // remote files that were deferred (and files from the cache)
+            // get checked once they are in view
+            fileButton.m_probed = !fileButton.m_fileInfo.m_pendingProbe &&
+                probes[i].m_state != FileProbeState::Cached;
+        }
+        else
+        {
+            fileButton.m_fileInfo.m_pendingProbe = true;
+        }
+        m_fileButtons.push_back(std::move(fileButton));
+    }
+    SortFileRows();
+
+    if (m_fileFilterEnabled || m_fileFilterIndex != nullptr)
+    {
+        BuildFileFilterIndex();
+    }
+    UpdateFileListButton();
+    InvalidateLayout(LAYOUT_FILE_ROWS);
+    if (HasFileWatcher())
+    {
+        UpdateWatchedDirectories();
+    }
+}
+
+//---------------------------------------------------
+void wxStartPage::SortFileRows()
+{
+    m_sortedFileRowCount = 0;
+    if (m_fileOrder != wxStartPageFileOrder::wxSortFilesByModifiedTime)
+    {
+        return;
+    }
+    // only the rows that were checked (or read from the cache) before the list
+    // is shown, so that rows don't move once they are on screen
+    const size_t maxSorted{ std::min(m_fileButtons.size(),
+                                     std::max(INITIAL_FILE_ROWS, GetFileRowsPerPage() + 1)) };
+    while (m_sortedFileRowCount < maxSorted)
+    {
+        const auto& fileInfo = m_fileButtons[m_sortedFileRowCount].m_fileInfo;
+        if (!fileInfo.m_exists || fileInfo.m_pendingProbe || !fileInfo.m_modTime.IsValid())
+        {
+            break;
+        }
+        ++m_sortedFileRowCount;
+    }
+    std::stable_sort(m_fileButtons.begin(), m_fileButtons.begin() + m_sortedFileRowCount,
+        [](const auto& lhv, const auto& rhv)
+        { return lhv.m_fileInfo.m_modTime.IsLaterThan(rhv.m_fileInfo.m_modTime); });
+}
+
+//---------------------------------------------------
+std::vector<wxStartPage::FileProbe> wxStartPage::LoadFileInfoCache(
+    const wxArrayString& mruFiles) const
+{
+    if (m_fileInfoCachePath.empty())
+    {
+        return {};
+    }
+    const TraceSpan span{ "LoadFileInfoCache" };
+    const MappedFile cacheFile{ m_fileInfoCachePath };
+    FileInfoCacheHeader header;
+    if (!ReadFileInfoCacheHeader(cacheFile, FILE_INFO_CACHE_VERSION, header))
+    {
+        return {};
+    }
+
+    // look up the cached paths where they are in the mapped file (rather than copying them)
+    std::unordered_map<std::string_view, FileInfoCacheEntry> entries;
+    entries.reserve(header.m_entryCount);
+    size_t offset{ sizeof(FileInfoCacheHeader) };
+    for (uint32_t i = 0; i < header.m_entryCount; ++i)
+    {
+        FileInfoCacheEntry entry;
+        if (cacheFile.GetSize() - offset < sizeof(FileInfoCacheEntry))
+        {
+            return {};
+        }
+        std::memcpy(&entry, cacheFile.GetData() + offset, sizeof(FileInfoCacheEntry));
+        offset += sizeof(FileInfoCacheEntry);
+        // truncated (or corrupt), so don't trust any of it
+        if (cacheFile.GetSize() - offset < entry.m_pathLength)
+        {
+            return {};
+        }
+        entries.emplace(std::string_view{ cacheFile.GetData() + offset, entry.m_pathLength },
+                        entry);
+        offset += entry.m_pathLength;
+    }
+
+    std::vector<FileProbe> probes;
+    probes.reserve(mruFiles.size());
+    bool anyCached{ false };
+    for (const auto& file : mruFiles)
+    {
+        FileProbe probe{ file, FileInfo{}, FileProbeState::Pending };
+        const std::string filePath{ file.utf8_string() };
+        const auto entry = entries.find(filePath);
+        if (entry != entries.cend())
+        {
+            anyCached = true;
+            const FileInfoCacheEntry& cached = entry->second;
+            probe.m_info.m_exists = (cached.m_flags & FileInfoCacheEntry::FILE_EXISTS) != 0;
+            probe.m_info.m_remote = (cached.m_flags & FileInfoCacheEntry::FILE_REMOTE) != 0;
+            if (probe.m_info.m_exists)
+            {
+                if (cached.m_modTime != FileInfoCacheEntry::NO_MOD_TIME)
+                {
+                    probe.m_info.m_modTime = wxDateTime{ wxLongLong{ cached.m_modTime } };
+                }
+                probe.m_info.m_size = wxULongLong{ static_cast<wxULongLong_t>(cached.m_size) };
+            }
+            probe.m_state = probe.m_info.m_exists ?
+                FileProbeState::Cached : FileProbeState::Missing;
+        }
+        probes.push_back(std::move(probe));
+    }
+    return anyCached ? probes : std::vector<FileProbe>{};
+}
+
+//---------------------------------------------------
+void wxStartPage::ProbeCachedMissingFiles(const std::vector<FileProbe>& probes)
+{
+    // only the files that would be on the first page if they were there
+    const size_t rowsToCheck{ std::max(GetVisibleFileRows().second, GetFileRowsPerPage()) };
+    size_t rowCount{ 0 };
+    for (size_t i = 0; i < probes.size() && rowCount < rowsToCheck; ++i)
+    {
+        if (probes[i].m_state != FileProbeState::Missing)
+        {
+            ++rowCount;
+        }
+        else if (!IsProbeBackingOff(probes[i].m_filePath))
+        {
+            QueueFileProbe(probes[i].m_filePath, rowCount);
+        }
+    }
+}
+
+//---------------------------------------------------
+bool wxStartPage::SaveFileInfoCache() const
+{
+    if (m_fileInfoCachePath.empty())
+    {
+        return false;
+    }
+
+    std::string buffer(sizeof(FileInfoCacheHeader), '\0');
+    uint32_t entryCount{ 0 };
+    const auto addEntry = [&buffer, &entryCount](const wxString& filePath, const FileInfo& info)
+        {
+            const std::string path{ filePath.utf8_string() };
+            FileInfoCacheEntry entry;
+            entry.m_modTime = info.m_modTime.IsValid() ?
+                static_cast<int64_t>(info.m_modTime.GetValue().GetValue()) :
+                FileInfoCacheEntry::NO_MOD_TIME;
+            entry.m_size = static_cast<uint64_t>(info.m_size.GetValue());
+            entry.m_pathLength = static_cast<uint32_t>(path.length());
+            entry.m_flags = (info.m_exists ? FileInfoCacheEntry::FILE_EXISTS : 0) |
+                (info.m_remote ? FileInfoCacheEntry::FILE_REMOTE : 0);
+            buffer.append(reinterpret_cast<const char*>(&entry), sizeof(FileInfoCacheEntry));
+            buffer.append(path);
+            ++entryCount;
+        };
+
+    // The rows are the client's list minus the missing files, but the ones at the top
+    // may have been sorted, so look up each file's row by its path.
+    // Files that haven't been checked aren't cached.
+    std::unordered_map<std::wstring, size_t> fileRows;
+    fileRows.reserve(m_fileButtons.size());
+    for (size_t row = 0; row < m_fileButtons.size(); ++row)
+    {
+        fileRows.emplace(MakeFilePathKey(m_fileButtons[row].m_fullFilePath), row);
+    }
+    for (const auto& mruFile : m_mruFiles)
+    {
+        const auto fileRow = fileRows.find(MakeFilePathKey(mruFile));
+        if (fileRow != fileRows.cend())
+        {
+            const FileInfo& info = m_fileButtons[fileRow->second].m_fileInfo;
+            if (!info.m_pendingProbe && !info.m_unavailable)
+            {
+                addEntry(mruFile, info);
+            }
+        }
+        else
+        {
+            addEntry(mruFile, FileInfo{});
+        }
+    }
+
+    FileInfoCacheHeader header;
+    header.m_magic = FILE_INFO_CACHE_MAGIC;
+    header.m_version = FILE_INFO_CACHE_VERSION;
+    header.m_entryCount = entryCount;
+    header.m_listHash = static_cast<uint64_t>(m_mruFilesHash);
+    std::memcpy(buffer.data(), &header, sizeof(FileInfoCacheHeader));
+
+    // write it next to the cache and then swap it in, so that a cache
+    // that is being read (or a crash while writing) never sees half a file
+    const wxString tempPath{ m_fileInfoCachePath + L".tmp" };
+    {
+        wxFile cacheFile;
+        if (!cacheFile.Create(tempPath, true) ||
+            cacheFile.Write(buffer.data(), buffer.size()) != buffer.size())
+        {
+            return false;
+        }
+    }
+    return wxRenameFile(tempPath, m_fileInfoCachePath, true);
+}
+
+//---------------------------------------------------
+bool wxStartPage::IsFileInfoCacheCurrent(const wxString& cachePath,
+                                         const wxArrayString& mruFiles)
+{
+    const MappedFile cacheFile{ cachePath };
+    FileInfoCacheHeader header;
+    return ReadFileInfoCacheHeader(cacheFile, FILE_INFO_CACHE_VERSION, header) &&
+        header.m_listHash == static_cast<uint64_t>(HashFileList(mruFiles));
+}
+
+//---------------------------------------------------
+void wxStartPage::EnableFileWatching(const bool enable /*= true*/)
+{
+#if wxUSE_FSWATCHER
+    m_fileWatching = enable;
+    // the watcher needs a running event loop, so (re)create it from there
+    CallAfter([this]() { UpdateWatchedDirectories(); });
+#else
+    wxUnusedVar(enable);
+#endif
+}
+
+//---------------------------------------------------
+void wxStartPage::UpdateWatchedDirectories()
+{
+#if wxUSE_FSWATCHER
+    if (!m_fileWatching)
+    {
+        m_fileWatcher.reset();
+        m_watchedDirectories.clear();
+        for (auto& fileButton : m_fileButtons)
+        {
+            fileButton.m_watched = false;
+        }
+        return;
+    }
+    if (m_fileWatcher == nullptr)
+    {
+        m_fileWatcher = std::make_unique<wxFileSystemWatcher>();
+        m_fileWatcher->SetOwner(this);
+        m_watchedDirectories.clear();
+    }
+
+    // count the folders again, but only add (or remove) the ones that changed
+    // (only the files that have been checked, i.e., scrolled into view, are watched)
+    std::unordered_map<std::wstring, WatchedDirectory> directories;
+    const auto addDirectory = [&directories](const wxString& filePath)
+        {
+            const wxString dir = wxFileName{ filePath }.GetPath();
+            auto& directory = directories[MakeFilePathKey(dir)];
+            if (directory.m_fileCount++ == 0)
+            {
+                directory.m_path = dir;
+            }
+        };
+    for (auto& fileButton : m_fileButtons)
+    {
+        fileButton.m_watched = fileButton.m_probed;
+        if (fileButton.m_watched)
+        {
+            addDirectory(fileButton.m_fullFilePath);
+        }
+    }
+    for (const auto& deletedFile : m_deletedFiles)
+    {
+        addDirectory(deletedFile);
+    }
+
+    for (const auto& [key, directory] : m_watchedDirectories)
+    {
+        if (directories.find(key) == directories.cend())
+        {
+            m_fileWatcher->Remove(wxFileName::DirName(directory.m_path));
+        }
+    }
+    for (const auto& [key, directory] : directories)
+    {
+        if (m_watchedDirectories.find(key) == m_watchedDirectories.cend())
+        {
+            m_fileWatcher->Add(wxFileName::DirName(directory.m_path),
+                wxFSW_EVENT_CREATE | wxFSW_EVENT_DELETE |
+                wxFSW_EVENT_RENAME | wxFSW_EVENT_MODIFY);
+        }
+    }
+    m_watchedDirectories = std::move(directories);
+#endif
+}
+
+//---------------------------------------------------
+void wxStartPage::WatchFileDirectory([[maybe_unused]] const wxString& filePath)
+{
+#if wxUSE_FSWATCHER
+    if (m_fileWatcher == nullptr)
+    {
+        return;
+    }
+    const wxString dir = wxFileName{ filePath }.GetPath();
+    auto& directory = m_watchedDirectories[MakeFilePathKey(dir)];
+    if (directory.m_fileCount++ == 0)
+    {
+        directory.m_path = dir;
+        m_fileWatcher->Add(wxFileName::DirName(dir),
+            wxFSW_EVENT_CREATE | wxFSW_EVENT_DELETE |
+            wxFSW_EVENT_RENAME | wxFSW_EVENT_MODIFY);
+    }
+#endif
+}
+
+//---------------------------------------------------
+void wxStartPage::UnwatchFileDirectory([[maybe_unused]] const wxString& filePath)
+{
+#if wxUSE_FSWATCHER
+    if (m_fileWatcher == nullptr)
+    {
+        return;
+    }
+    const auto directory =
+        m_watchedDirectories.find(MakeFilePathKey(wxFileName{ filePath }.GetPath()));
+    if (directory != m_watchedDirectories.end() && --directory->second.m_fileCount == 0)
+    {
+        m_fileWatcher->Remove(wxFileName::DirName(directory->second.m_path));
+        m_watchedDirectories.erase(directory);
+    }
+#endif
+}
+
+//---------------------------------------------------
+void wxStartPage::WatchFileRow(wxStartPageButton& fileButton)
+{
+    if (!HasFileWatcher() || fileButton.m_watched)
+    {
+        return;
+    }
+    fileButton.m_watched = true;
+    WatchFileDirectory(fileButton.m_fullFilePath);
+}
+
+//---------------------------------------------------
+void wxStartPage::UnwatchFileRow(wxStartPageButton& fileButton)
+{
+    if (!fileButton.m_watched)
+    {
+        return;
+    }
+    fileButton.m_watched = false;
+    UnwatchFileDirectory(fileButton.m_fullFilePath);
+}
+
+//---------------------------------------------------
+void wxStartPage::OnFileSystemChange([[maybe_unused]] wxFileSystemWatcherEvent& event)
+{
+#if wxUSE_FSWATCHER
+    const int changeType = event.GetChangeType();
+    if ((changeType & wxFSW_EVENT_RENAME) != 0)
+    {
+        OnWatchedFileChanged(event.GetPath().GetFullPath());
+        OnWatchedFileChanged(event.GetNewPath().GetFullPath());
+    }
+    else if ((changeType &
+              (wxFSW_EVENT_CREATE | wxFSW_EVENT_DELETE | wxFSW_EVENT_MODIFY)) != 0)
+    {
+        OnWatchedFileChanged(event.GetPath().GetFullPath());
+    }
+#endif
+}
+
+//---------------------------------------------------
+void wxStartPage::OnWatchedFileChanged(const wxString& filePath)
+{
+    // already being checked, the probe will pick up the change
+    if (m_probesInFlight.find(filePath) != m_probesInFlight.cend())
+    {
+        return;
+    }
+
+    const size_t row{ FindFileRow(filePath) };
+    // if not in the list, then only a file from the client's list that
+    // was missing (or deleted) and has been recreated is of interest
+    if (row == GetMRUFileCount())
+    {
+        if (FindMRUIndex(filePath) == m_mruFiles.size())
+        {
+            return;
+        }
+    }
+    // not checked yet, it will be once it is scrolled into view
+    else if (!m_fileButtons[row].m_probed)
+    {
+        return;
+    }
+
+    // check it in the background (with a deadline) if the client asked for that,
+    // since a change on a network drive can still stall the file system
+    if (m_asyncFileProbing)
+    {
+        // recently timed out, so don't wait on it again yet
+        if (!IsProbeBackingOff(filePath))
+        {
+            QueueFileProbe(filePath, row);
+        }
+        return;
+    }
+    const FileProbe probe = ProbeFileNow(filePath, m_remoteFilePolicy, false);
+    RecordFileProbe(probe.m_latency);
+    UpdateFileRow(filePath, probe.m_info, row);
+}
+
+//---------------------------------------------------
+size_t wxStartPage::FindFileRow(const wxString& filePath, const size_t rowHint /*= 0*/) const
+{
+    if (rowHint < GetMRUFileCount() &&
+        IsSameFilePath(m_fileButtons[rowHint].m_fullFilePath, filePath))
+    {
+        return rowHint;
+    }
+    for (size_t i = 0; i < GetMRUFileCount(); ++i)
+    {
+        if (IsSameFilePath(m_fileButtons[i].m_fullFilePath, filePath))
+        {
+            return i;
+        }
+    }
+    return GetMRUFileCount();
+}
+
+//---------------------------------------------------
+size_t wxStartPage::FindFileRowInsertPosition(const wxString& filePath,
+                                              const FileInfo& fileInfo) const
+{
+    // newer than one of the sorted rows, so it goes among them
+    if (fileInfo.m_exists && fileInfo.m_modTime.IsValid())
+    {
+        for (size_t row = 0; row < m_sortedFileRowCount; ++row)
+        {
+            const wxDateTime& modTime{ m_fileButtons[row].m_fileInfo.m_modTime };
+            if (modTime.IsValid() && fileInfo.m_modTime.IsLaterThan(modTime))
+            {
+                return (FindMRUIndex(filePath) < m_mruFiles.size()) ? row : wxString::npos;
+            }
+        }
+    }
+
+    // the rest of the rows are the client's list (in the same order) minus the
+    // missing (and sorted) files, so walk them together
+    size_t row{ m_sortedFileRowCount };
+    for (const auto& mruFile : m_mruFiles)
+    {
+        if (IsSameFilePath(mruFile, filePath))
+        {
+            return row;
+        }
+        if (row < GetMRUFileCount() &&
+            IsSameFilePath(mruFile, m_fileButtons[row].m_fullFilePath))
+        {
+            ++row;
+        }
+    }
+    return wxString::npos;
+}
+
+//---------------------------------------------------
+size_t wxStartPage::FindMRUIndex(const wxString& filePath) const
+{
+    for (size_t i = 0; i < m_mruFiles.size(); ++i)
+    {
+        if (IsSameFilePath(m_mruFiles[i], filePath))
+        {
+            return i;
+        }
+    }
+    return m_mruFiles.size();
+}
+
+//---------------------------------------------------
+void wxStartPage::UpdateFileRow(const wxString& filePath, const FileInfo& fileInfo,
+                                const size_t rowHint /*= 0*/)
+{
+    size_t row{ FindFileRow(filePath, rowHint) };
+    // how many times it was being watched for as a deleted file (until it was recreated)
+    size_t recreatedCount{ 0 };
+    if (row == GetMRUFileCount())
+    {
+        if (!fileInfo.IsShown())
+        {
+            return;
+        }
+        // (re)created, so show it where it belongs in the list
+        row = FindFileRowInsertPosition(filePath, fileInfo);
+        if (row == wxString::npos)
+        {
+            return;
+        }
+        InsertFileRow(row, filePath);
+        const auto deletedFiles = std::remove_if(m_deletedFiles.begin(), m_deletedFiles.end(),
+            [&filePath](const auto& deletedFile) { return IsSameFilePath(deletedFile, filePath); });
+        recreatedCount = static_cast<size_t>(std::distance(deletedFiles, m_deletedFiles.end()));
+        m_deletedFiles.erase(deletedFiles, m_deletedFiles.end());
+    }
+    else if (!fileInfo.IsShown())
+    {
+        // If it was shown as existing, then it was deleted (rather than found
+        // missing when first checked), so keep watching its folder in case it is recreated.
+        if (!m_fileButtons[row].m_fileInfo.m_pendingProbe)
+        {
+            m_deletedFiles.push_back(filePath);
+            WatchFileDirectory(filePath);
+        }
+        RemoveFileRow(row);
+        return;
+    }
+
+    auto& fileButton = m_fileButtons[row];
+    fileButton.m_fileInfo = fileInfo;
+    fileButton.m_timeLabelValid = false;
+    fileButton.m_probed = true;
+    WatchFileRow(fileButton);
+    // (after its row is watched, so that the folder isn't dropped and added again)
+    for (size_t i = 0; i < recreatedCount; ++i)
+    {
+        UnwatchFileDirectory(filePath);
+    }
+    const size_t shownRow{ FindEntryRow(row) };
+    if (shownRow < GetFileRowCount() && GetFileRowEntry(shownRow) == row)
+    {
+        RefreshFileRows(shownRow, shownRow);
+    }
+}
+
+//---------------------------------------------------
+void wxStartPage::InsertFileRow(const size_t row, const wxString& filePath)
+{
+    // (a file added at the top, or a newer file, is part of the sorted rows)
+    if (row < m_sortedFileRowCount)
+    {
+        ++m_sortedFileRowCount;
+    }
+    wxStartPageButton fileButton;
+    fileButton.m_fullFilePath = filePath;
+    fileButton.m_fileInfo.m_pendingProbe = true;
+    if (m_fileFilterIndex != nullptr)
+    {
+        fileButton.m_filterId = m_fileFilterIndex->Add(filePath);
+    }
+
+    if (IsFileListFiltered())
+    {
+        // (the new ID is the largest, so the matches stay sorted)
+        if (m_fileFilterIndex->Matches(fileButton.m_filterId, m_fileFilterKey))
+        {
+            m_filterMatches.push_back(fileButton.m_filterId);
+        }
+        const size_t activeEntry{ GetActiveFileEntry() };
+        m_fileButtons.insert(m_fileButtons.begin() + row, std::move(fileButton));
+        RefilterFileRows((activeEntry != wxString::npos && activeEntry >= row) ?
+                         activeEntry + 1 : activeEntry);
+        return;
+    }
+    m_fileButtons.insert(m_fileButtons.begin() + row, std::move(fileButton));
+
+    // keep the highlight on the same file
+    if (IsFileId(m_activeButton) && GetFileRow(m_activeButton) >= row)
+    {
+        m_activeButton = GetFileRowId(GetFileRow(m_activeButton) + 1);
+    }
+
+    if (GetMRUFileCount() == 1)
+    {
+        UpdateFileListButton();
+        Refresh();
+        return;
+    }
+    // added above what is scrolled into view, so keep the view where it is
+    if (m_fileScrollPosition > 0 &&
+        GetFileRowRect(row).GetTop() < GetFileRowsViewRect().GetTop())
+    {
+        m_fileScrollPosition += GetMRUButtonHeight();
+    }
+    RefreshFileRows(row, GetMRUFileCount());
+}
+
+//---------------------------------------------------
+void wxStartPage::RemoveFileRow(const size_t row)
+{
+    if (row < m_sortedFileRowCount)
+    {
+        --m_sortedFileRowCount;
+    }
+    UnwatchFileRow(m_fileButtons[row]);
+    if (m_fileFilterIndex != nullptr)
+    {
+        m_fileFilterIndex->Remove(m_fileButtons[row].m_filterId);
+    }
+    if (IsFileListFiltered())
+    {
+        // (if the highlighted file was removed, then the file after it takes its place)
+        const size_t activeEntry{ GetActiveFileEntry() };
+        m_fileButtons.erase(m_fileButtons.begin() + row);
+        TrimFileFilterIndex();
+        RefilterFileRows((activeEntry != wxString::npos && activeEntry > row) ?
+                         activeEntry - 1 : activeEntry);
+        return;
+    }
+
+    const bool aboveView{ GetFileRowRect(row).GetTop() < GetFileRowsViewRect().GetTop() };
+    m_fileButtons.erase(m_fileButtons.begin() + row);
+    TrimFileFilterIndex();
+
+    // keep the highlight on the same file (or the one that took its place)
+    if (IsFileId(m_activeButton))
+    {
+        const size_t activeRow{ GetFileRow(m_activeButton) };
+        if (activeRow > row || (activeRow == row && row == GetMRUFileCount()))
+        {
+            m_activeButton = (activeRow > 0) ? GetFileRowId(activeRow - 1) : wxNOT_FOUND;
+        }
+    }
+
+    if (m_fileButtons.empty())
+    {
+        m_activeButton = IsFileId(m_activeButton) ? wxNOT_FOUND : m_activeButton;
+        m_fileScrollPosition = 0;
+        UpdateFileListButton();
+        Refresh();
+        return;
+    }
+
+    // removed above what is scrolled into view, so keep the view where it is
+    if (aboveView)
+    {
+        m_fileScrollPosition = std::max<wxCoord>(0, m_fileScrollPosition - GetMRUButtonHeight());
+    }
+    // the list got shorter, so it may not scroll as far now
+    if (m_fileScrollPosition > GetMaxFileScrollPosition())
+    {
+        m_fileScrollPosition = GetMaxFileScrollPosition();
+        RefreshFileRows(0, GetMRUFileCount());
+    }
+    else
+    {
+        RefreshFileRows(row, GetMRUFileCount());
+    }
+    // rows may have moved up into view
+    ProbeVisibleRows();
+}
+
+//---------------------------------------------------
+size_t wxStartPage::HashFileList(const wxArrayString& files)
+{
+    // FNV-1a over the characters of every path (with a separator between them)
+    size_t hash{ 14695981039346656037ULL & SIZE_MAX };
+    const auto hashValue = [&hash](const size_t value)
+        {
+            hash ^= value;
+            hash *= static_cast<size_t>(1099511628211ULL & SIZE_MAX);
+        };
+    for (const auto& file : files)
+    {
+        for (const auto ch : file)
+        {
+            hashValue(static_cast<size_t>(ch));
+        }
+        hashValue(0);
+    }
+    return hash;
+}
+
+//---------------------------------------------------
+wxStartPage::FileProbePool& wxStartPage::GetProbePool()
+{
+    if (m_probePool == nullptr)
+    {
+        m_probePool = FileProbePool::Create(this);
+        m_probePool->SetGeneration(m_probeGeneration);
+    }
+    return *m_probePool;
+}
+
+//---------------------------------------------------
+void wxStartPage::AddMRUFile(const wxString& filePath)
+{
+    if (FindMRUIndex(filePath) < m_mruFiles.size())
+    {
+        PromoteMRUFile(filePath);
+        return;
+    }
+
+    m_mruFiles.Insert(filePath, 0);
+    m_mruFilesHash = HashFileList(m_mruFiles);
+    InsertFileRow(0, filePath);
+    ProbeVisibleRows();
+}
+
+//---------------------------------------------------
+void wxStartPage::PromoteMRUFile(const wxString& filePath)
+{
+    const size_t mruIndex{ FindMRUIndex(filePath) };
+    if (mruIndex == 0 || mruIndex >= m_mruFiles.size())
+    {
+        return;
+    }
+
+    m_mruFiles.RemoveAt(mruIndex);
+    m_mruFiles.Insert(filePath, 0);
+    m_mruFilesHash = HashFileList(m_mruFiles);
+
+    const size_t row{ FindFileRow(filePath) };
+    // not shown (it was missing), so check it again at the top
+    if (row == GetMRUFileCount())
+    {
+        InsertFileRow(0, filePath);
+        ProbeVisibleRows();
+        return;
+    }
+    if (row == 0)
+    {
+        return;
+    }
+
+    // move it (and what is known about it) to the top;
+    // only the rows above where it was move
+    if (row >= m_sortedFileRowCount && m_sortedFileRowCount > 0)
+    {
+        ++m_sortedFileRowCount;
+    }
+    const size_t activeEntry{ GetActiveFileEntry() };
+    std::rotate(m_fileButtons.begin(), m_fileButtons.begin() + row,
+                m_fileButtons.begin() + row + 1);
+    if (IsFileListFiltered())
+    {
+        RefilterFileRows((activeEntry == row) ? 0 :
+                         (activeEntry < row) ? activeEntry + 1 : activeEntry);
+        return;
+    }
+    if (IsFileId(m_activeButton) && GetFileRow(m_activeButton) <= row)
+    {
+        m_activeButton = (GetFileRow(m_activeButton) == row) ?
+            GetFileRowId(0) : GetFileRowId(GetFileRow(m_activeButton) + 1);
+    }
+    RefreshFileRows(0, row);
+}
+
+//---------------------------------------------------
+void wxStartPage::RemoveMRUFile(const wxString& filePath)
+{
+    const size_t mruIndex{ FindMRUIndex(filePath) };
+    if (mruIndex >= m_mruFiles.size())
+    {
+        return;
+    }
+
+    m_mruFiles.RemoveAt(mruIndex);
+    m_mruFilesHash = HashFileList(m_mruFiles);
+    m_probesInFlight.erase(filePath);
+    // removed by the client (not deleted), so no need to watch for it
+    const auto deletedFiles = std::remove_if(m_deletedFiles.begin(), m_deletedFiles.end(),
+        [&filePath](const auto& deletedFile) { return IsSameFilePath(deletedFile, filePath); });
+    for (auto deletedFile = deletedFiles; deletedFile != m_deletedFiles.end(); ++deletedFile)
+    {
+        UnwatchFileDirectory(filePath);
+    }
+    m_deletedFiles.erase(deletedFiles, m_deletedFiles.end());
+
+    const size_t row{ FindFileRow(filePath) };
+    if (row < GetMRUFileCount())
+    {
+        RemoveFileRow(row);
+    }
+}
+
+//---------------------------------------------------
+void wxStartPage::EnableFileFilter(const bool enable /*= true*/)
+{
+    if (enable == m_fileFilterEnabled)
+    {
+        return;
+    }
+    m_fileFilterEnabled = enable;
+
+    if (enable)
+    {
+        m_searchCtrl = new wxSearchCtrl(this, wxID_ANY);
+        m_searchCtrl->SetDescriptiveText(_(L"Search recent files"));
+        m_searchCtrl->ShowCancelButton(true);
+        m_searchCtrl->ChangeValue(m_fileFilter);
+        m_searchCtrl->Bind(wxEVT_TEXT,
+            [this](wxCommandEvent& event) { SetFileFilter(event.GetString()); });
+        m_searchCtrl->Bind(wxEVT_SEARCH_CANCEL,
+            [this]([[maybe_unused]] wxCommandEvent& event) { SetFileFilter(wxString{}); });
+        // open the best (i.e., most recent) match
+        m_searchCtrl->Bind(wxEVT_SEARCH,
+            [this]([[maybe_unused]] wxCommandEvent& event)
+            {
+                if (IsFileListFiltered() && GetFileRowCount() > 0)
+                {
+                    ActivateButton(GetFileRowId(0));
+                }
+            });
+        if (m_fileFilterIndex == nullptr)
+        {
+            BuildFileFilterIndex();
+        }
+    }
+    else
+    {
+        m_searchCtrl->Destroy();
+        m_searchCtrl = nullptr;
+        SetFileFilter(wxString{});
+        m_fileFilterIndex.reset();
+    }
+
+    // the search box changes the height of the header above the list
+    SendSizeEvent();
+    Refresh();
+}
+
+//---------------------------------------------------
+void wxStartPage::SetFileFilter(const wxString& filter)
+{
+    if (filter == m_fileFilter)
+    {
+        return;
+    }
+    if (m_fileFilterIndex == nullptr)
+    {
+        BuildFileFilterIndex();
+    }
+
+    const std::string filterKey{ FileFilterIndex::MakeKey(filter) };
+    // if the search text was added to, then only what matched before can still match
+    const bool narrowing{ IsFileListFiltered() &&
+                          filterKey.find(m_fileFilterKey) != std::string::npos };
+    m_fileFilter = filter;
+    m_fileFilterKey = filterKey;
+    if (IsFileListFiltered())
+    {
+        m_filterMatches =
+            m_fileFilterIndex->Find(m_fileFilterKey, narrowing ? &m_filterMatches : nullptr);
+    }
+    else
+    {
+        m_filterMatches.clear();
+    }
+    FilterFileRows();
+
+    if (m_searchCtrl != nullptr && m_searchCtrl->GetValue() != m_fileFilter)
+    {
+        m_searchCtrl->ChangeValue(m_fileFilter);
+    }
+    m_fileScrollPosition = 0;
+    if (IsFileId(m_activeButton))
+    {
+        m_activeButton = wxNOT_FOUND;
+    }
+    RefreshFileRows(0, GetFileRowCount());
+    ProbeVisibleRows();
+}
+
+//---------------------------------------------------
+void wxStartPage::BuildFileFilterIndex()
+{
+    const TraceSpan span{ "BuildFileFilterIndex" };
+    m_fileFilterIndex = std::make_unique<FileFilterIndex>();
+    for (auto& fileButton : m_fileButtons)
+    {
+        fileButton.m_filterId = m_fileFilterIndex->Add(fileButton.m_fullFilePath);
+    }
+    m_filterMatches = IsFileListFiltered() ?
+        m_fileFilterIndex->Find(m_fileFilterKey, nullptr) :
+        std::vector<uint32_t>{};
+    FilterFileRows();
+}
+
+//---------------------------------------------------
+void wxStartPage::TrimFileFilterIndex()
+{
+    if (m_fileFilterIndex != nullptr && m_fileFilterIndex->IsMostlyRemoved())
+    {
+        BuildFileFilterIndex();
+    }
+}
+
+//---------------------------------------------------
+void wxStartPage::FilterFileRows()
+{
+    m_filteredRows.clear();
+    if (!IsFileListFiltered())
+    {
+        return;
+    }
+    std::vector<bool> matched(m_fileFilterIndex->GetSize(), false);
+    for (const auto id : m_filterMatches)
+    {
+        matched[id] = true;
+    }
+    for (size_t i = 0; i < m_fileButtons.size(); ++i)
+    {
+        if (matched[m_fileButtons[i].m_filterId])
+        {
+            m_filteredRows.push_back(i);
+        }
+    }
+}
+
+//---------------------------------------------------
+void wxStartPage::RefilterFileRows(const size_t activeEntry)
+{
+    const bool fileWasActive{ IsFileId(m_activeButton) };
+    FilterFileRows();
+
+    if (fileWasActive)
+    {
+        const size_t activeRow{ (activeEntry != wxString::npos) ?
+            FindEntryRow(activeEntry) : GetFileRowCount() };
+        m_activeButton = (activeRow < GetFileRowCount()) ? GetFileRowId(activeRow) :
+            (GetFileRowCount() > 0) ? GetFileRowId(GetFileRowCount() - 1) :
+            wxNOT_FOUND;
+    }
+    m_fileScrollPosition = std::min(m_fileScrollPosition, GetMaxFileScrollPosition());
+    UpdateFileListButton();
+    // the rows that match may be anywhere, so redraw them all
+    RefreshFileRows(0, GetFileRowCount());
+    ProbeVisibleRows();
+}
+
+//---------------------------------------------------
+wxCoord wxStartPage::GetFileFilterHeight() const
+{
+    return (m_searchCtrl != nullptr) ?
+        m_searchCtrl->GetBestSize().GetHeight() + (2 * GetLabelPaddingHeight()) :
+        0;
+}
+
+//---------------------------------------------------
+void wxStartPage::RefreshFileRows(const size_t firstRow, const size_t lastRow)
+{
+    // the rows' labels (or how many rows there are) changed
+    InvalidateLayout(LAYOUT_FILE_ROWS);
+
+    const wxRect viewRect{ GetFileRowsViewRect() };
+    wxRect rowsRect{ GetFileRowRect(firstRow) };
+    if (lastRow >= GetFileRowCount())
+    {
+        // everything below moves (including the button under the list)
+        rowsRect.SetBottom(GetClientSize().GetHeight() - 1);
+    }
+    else
+    {
+        rowsRect.SetBottom(std::min(GetFileRowRect(lastRow).GetBottom(),
+                                    viewRect.GetBottom()));
+    }
+    // rows scrolled out of view aren't drawn
+    if (rowsRect.GetTop() < viewRect.GetTop())
+    {
+        rowsRect.SetTop(viewRect.GetTop());
+    }
+    if (rowsRect.GetHeight() <= 0)
+    {
+        return;
+    }
+    rowsRect.Inflate(GetLabelPaddingHeight());
+    Refresh(true, &rowsRect);
+}
+
+//---------------------------------------------------
+wxCoord wxStartPage::GetFileRowsMaxHeight() const
+{
+    // the button under the list is always shown, so the rows get what is left
+    return std::max<wxCoord>(0,
+        GetPageSize().GetHeight() - m_fileColumnHeaderHeight -
+        m_fileListButtonHeight - GetLabelPaddingHeight());
+}
+
+//---------------------------------------------------
+size_t wxStartPage::GetFileRowsPerPage() const
+{
+    // the window hasn't been laid out yet
+    if (GetMRUButtonHeight() <= 0 || GetFileRowsMaxHeight() <= 0)
+    {
+        return INITIAL_FILE_ROWS;
+    }
+    return std::max<size_t>(1, GetFileRowsMaxHeight() / GetMRUButtonHeight());
+}
+
+//---------------------------------------------------
+wxRect wxStartPage::GetFileRowsViewRect() const
+{
+    const wxCoord filesLeft = m_buttonWidth + (GetLeftBorder() * 2);
+    // (if nothing matches the filter, then leave a row for saying so)
+    const wxCoord rowsHeight =
+        static_cast<wxCoord>(IsFileListFiltered() ?
+            std::max<size_t>(GetFileRowCount(), 1) : GetFileRowCount()) *
+        GetMRUButtonHeight();
+    return wxRect{ filesLeft + FromDIP(1), m_fileColumnHeaderHeight,
+                   GetPageSize().GetWidth() - filesLeft - FromDIP(2),
+                   std::min(rowsHeight, GetFileRowsMaxHeight()) };
+}
+
+//---------------------------------------------------
+wxRect wxStartPage::GetFileRowRect(const size_t row) const
+{
+    const wxRect viewRect{ GetFileRowsViewRect() };
+    return wxRect{ viewRect.GetLeft(),
+                   viewRect.GetTop() + (static_cast<wxCoord>(row) * GetMRUButtonHeight()) -
+                       m_fileScrollPosition,
+                   viewRect.GetWidth(), GetMRUButtonHeight() };
+}
+
+//---------------------------------------------------
+std::pair<size_t, size_t> wxStartPage::GetVisibleFileRows() const
+{
+    // not laid out yet, so use the rows that would probably fit
+    if (GetMRUButtonHeight() <= 0)
+    {
+        return std::make_pair(0, std::min(GetFileRowCount(), INITIAL_FILE_ROWS));
+    }
+    const wxCoord rowHeight{ GetMRUButtonHeight() };
+    const size_t firstRow = std::min<size_t>(m_fileScrollPosition / rowHeight, GetFileRowCount());
+    const size_t lastRow = std::min<size_t>(
+        (m_fileScrollPosition + GetFileRowsViewRect().GetHeight() + rowHeight - 1) / rowHeight,
+        GetFileRowCount());
+    return std::make_pair(firstRow, std::max(firstRow, lastRow));
+}
+
+//---------------------------------------------------
+wxCoord wxStartPage::GetMaxFileScrollPosition() const
+{
+    return std::max<wxCoord>(0,
+        (static_cast<wxCoord>(GetFileRowCount()) * GetMRUButtonHeight()) -
+        GetFileRowsMaxHeight());
+}
+
+//---------------------------------------------------
+void wxStartPage::ScrollFileRows(const wxCoord position)
+{
+    const wxCoord newPosition = std::clamp<wxCoord>(position, 0, GetMaxFileScrollPosition());
+    if (newPosition == m_fileScrollPosition)
+    {
+        return;
     }
+    m_fileScrollPosition = newPosition;
+    InvalidateLayout(LAYOUT_FILE_ROWS);
+
+    wxRect viewRect{ GetFileRowsViewRect() };
+    viewRect.Inflate(GetLabelPaddingHeight());
+    Refresh(true, &viewRect);
+    ProbeVisibleRows();
 }
 
 //---------------------------------------------------
-void wxStartPage::DrawHighlight(wxDC& dc, const wxRect& rect,
-    const wxColour& color) const
+void wxStartPage::EnsureFileRowVisible(const size_t row)
 {
-    const wxDCPenChanger pc{ dc, wxColour{ 211, 211, 211 } };
-    if (m_style == wxStartPageStyle::wxStartPage3D)
+    const wxRect viewRect{ GetFileRowsViewRect() };
+    const wxRect rowRect{ GetFileRowRect(row) };
+    if (rowRect.GetTop() < viewRect.GetTop())
     {
-        // fill with the color
-        dc.GradientFillLinear(rect, color, color.ChangeLightness(140), wxSOUTH);
-        // create a shiny overlay
-        dc.GradientFillLinear(wxRect(rect.GetX(), rect.GetY(),
-            rect.GetWidth(), rect.GetHeight() * 0.25),
-            wxColour(255, 255, 255, 25),
-            wxColour(255, 255, 255, 125), wxSOUTH);
-        dc.DrawLine(rect.GetLeftTop(), rect.GetRightTop());
-        dc.DrawLine(rect.GetRightTop(), rect.GetRightBottom());
-        dc.DrawLine(rect.GetRightBottom(), rect.GetLeftBottom());
-        dc.DrawLine(rect.GetLeftBottom(), rect.GetLeftTop());
+        ScrollFileRows(m_fileScrollPosition - (viewRect.GetTop() - rowRect.GetTop()));
     }
-    else
+    else if (rowRect.GetBottom() > viewRect.GetBottom())
     {
-        const wxDCBrushChanger bc(dc, color);
-        dc.DrawRectangle(rect);
+        ScrollFileRows(m_fileScrollPosition + (rowRect.GetBottom() - viewRect.GetBottom()));
     }
 }
 
 //---------------------------------------------------
-void wxStartPage::SetMRUList(const wxArrayString& mruFiles)
+wxRect wxStartPage::GetButtonRect(const wxWindowID id) const
 {
-    m_fileButtons.clear();
-    m_fileButtons.reserve(mruFiles.size() + 1);
-    if (mruFiles.IsEmpty())
-    {
-        const wxVector<wxBitmap> bmps = {
-            wxArtProvider::GetBitmap(wxART_FOLDER_OPEN, wxART_BUTTON,
-                                     ScaleToContentSize(FromDIP(wxSize{ 16, 16 }))),
-            wxArtProvider::GetBitmap(wxART_FOLDER_OPEN, wxART_BUTTON,
-                                     ScaleToContentSize(FromDIP(wxSize{ 32, 32 }))),
-            wxArtProvider::GetBitmap(wxART_FOLDER_OPEN, wxART_BUTTON,
-                                     ScaleToContentSize(FromDIP(wxSize{ 64, 64 })))
-        };
-        m_fileButtons.resize(1);
-        m_fileButtons[0].m_id = START_PAGE_BROWSE_FILE;
-        m_fileButtons[0].m_label = GetBrowseForFileLabel();
-        m_fileButtons[0].m_icon = wxBitmapBundle::FromBitmaps(bmps);
-        return;
+    if (IsCustomButtonId(id))
+    {
+        return m_buttons[id - ID_BUTTON_ID_START].m_rect;
     }
+    if (IsFileListButtonId(id))
+    {
+        return (id == m_fileListButton.m_id) ? m_fileListButton.m_rect : wxRect{};
+    }
+    if (IsFileId(id) && GetFileRow(id) < GetFileRowCount())
+    {
+        // only the part that is scrolled into view
+        const wxRect viewRect{ GetFileRowsViewRect() };
+        const wxRect rowRect{ GetFileRowRect(GetFileRow(id)) };
+        return rowRect.Intersects(viewRect) ? rowRect.Intersect(viewRect) : wxRect{};
+    }
+    return wxRect{};
+}
 
-    const auto simplifyFilePath = [](auto path)
-        {
-            path = wxFileName(path).GetPath();
-            // shorten standard user paths
-            path.Replace(
-                wxStandardPaths::Get().GetUserDir(wxStandardPathsBase::Dir::Dir_Documents),
-                _(L"Documents"));
-            path.Replace(
-                wxStandardPaths::Get().GetUserDir(wxStandardPathsBase::Dir::Dir_Desktop),
-                _(L"Desktop"));
-            path.Replace(
-                wxStandardPaths::Get().GetUserDir(wxStandardPathsBase::Dir::Dir_Pictures),
-                _(L"Pictures"));
-            path.Replace(
-                wxStandardPaths::Get().GetUserDir(wxStandardPathsBase::Dir::Dir_Videos),
-                _(L"Videos"));
-            path.Replace(
-                wxStandardPaths::Get().GetUserDir(wxStandardPathsBase::Dir::Dir_Music),
-                _(L"Music"));
-            path.Replace(
-                wxStandardPaths::Get().GetUserDir(wxStandardPathsBase::Dir::Dir_Downloads),
-                _(L"Downloads"));
-            // replace slashes with guillemets (makes it look fancier)
-            path.Replace(wxFileName::GetPathSeparator(), L" \u00BB ", true);
-            return path;
-        };
-
-    // load files that can be found
-    std::vector<wxString> files;
-    for (const auto& file : mruFiles)
+//---------------------------------------------------
+wxWindowID wxStartPage::HitTest(const wxPoint& pt) const
+{
+    // buttons are stacked at a fixed height, so the button under the point can be calculated
+    if (m_buttonHeight > 0 && pt.y >= m_buttonsStart)
     {
-        if (wxFileName::FileExists(file))
+        const size_t index = static_cast<size_t>((pt.y - m_buttonsStart) / m_buttonHeight);
+        if (index < m_buttons.size() && m_buttons[index].IsOk() &&
+            m_buttons[index].m_rect.Contains(pt))
         {
-            files.push_back(file);
+            return m_buttons[index].m_id;
         }
-        // no more than 9 items here, not enough real estate
-        if (files.size() == MAX_FILE_BUTTONS)
+    }
+
+    // rows are a fixed height, so the row under the point can be calculated
+    const wxRect viewRect{ GetFileRowsViewRect() };
+    if (GetMRUButtonHeight() > 0 && viewRect.Contains(pt))
+    {
+        const size_t row = static_cast<size_t>(
+            (pt.y - viewRect.GetTop() + m_fileScrollPosition) / GetMRUButtonHeight());
+        if (row < GetFileRowCount())
         {
-            break;
+            return GetFileRowId(row);
         }
     }
-    // no files, so no need for file buttons or the clear all button
-    if (files.empty())
+
+    if (m_fileListButton.IsOk() && m_fileListButton.m_rect.Contains(pt))
     {
-        m_fileButtons.resize(1);
-        m_fileButtons[0].m_id = START_PAGE_BROWSE_FILE;
-        m_fileButtons[0].m_label = GetBrowseForFileLabel();
-        return;
+        return m_fileListButton.m_id;
     }
+    return wxNOT_FOUND;
+}
 
-    std::sort(files.begin(), files.end(),
-        [](const auto& lhv, const auto& rhv)
-        {
-            const wxFileName fn1(lhv), fn2(rhv);
-            wxDateTime accessTime1, modTime1, createTime1,
-                accessTime2, modTime2, createTime2;
-            fn1.GetTimes(&accessTime1, &modTime1, &createTime1);
-            fn2.GetTimes(&accessTime2, &modTime2, &createTime2);
-            // going in reverse, most recently modified goes to the front
-            return modTime1 > modTime2;
-        });
-
-    // connect the file paths to the buttons in the MRU list
-    m_fileButtons.resize(files.size() + 1);
-    for (size_t buttonCount = 0; buttonCount < files.size(); ++buttonCount)
+//---------------------------------------------------
+const wxString& wxStartPage::GetGreeting()
+{
+    const wxDateTime now{ GetCurrentTime() };
+    if (!m_greetingValid ||
+        (m_greetingExpiration.IsValid() && now >= m_greetingExpiration))
     {
-        m_fileButtons[buttonCount].m_id = ID_FILE_ID_START + buttonCount;
-        m_fileButtons[buttonCount].m_fullFilePath = files[buttonCount];
-        m_fileButtons[buttonCount].m_label = simplifyFilePath(files[buttonCount]);
+        m_greeting = FormatGreeting(now, m_greetingExpiration);
+        m_greetingValid = true;
     }
-
-    m_fileButtons.back().m_id = START_PAGE_FILE_LIST_CLEAR;
-    m_fileButtons.back().m_label = GetClearFileListLabel();
+    return m_greeting;
 }
 
 //---------------------------------------------------
-wxString wxStartPage::FormatGreeting() const
+wxString wxStartPage::FormatGreeting(const wxDateTime& now, wxDateTime& expiration) const
 {
+    expiration = wxDateTime{};
     if (m_greetingStyle == wxStartPageGreetingStyle::wxNoGreeting)
     {
         return wxString{};
@@ -370,10 +3631,15 @@ wxString wxStartPage::FormatGreeting() const
     {
         return m_customGreeting;
     }
+
+    // the greeting changes at noon, 5 PM, and midnight
+    const auto currentHour{ now.GetHour() };
+    expiration = (currentHour < 12) ? now.GetDateOnly() + wxTimeSpan::Hours(12) :
+        (currentHour < 17) ? now.GetDateOnly() + wxTimeSpan::Hours(17) :
+        now.GetDateOnly() + wxDateSpan::Day();
     if (m_greetingStyle == wxStartPageGreetingStyle::wxDynamicGreetingWithUserName &&
         !m_userName.empty())
     {
-        const auto currentHour{ wxDateTime::Now().GetHour() };
         return currentHour < 12 ?
             wxString::Format(_(L"Good morning, %s"), m_userName) :
             currentHour < 17 ?
@@ -381,7 +3647,6 @@ wxString wxStartPage::FormatGreeting() const
             wxString::Format(_(L"Good evening, %s"), m_userName);
     }
 
-    const auto currentHour{ wxDateTime::Now().GetHour() };
     return currentHour < 12 ? _(L"Good morning") :
         currentHour < 17 ? _(L"Good afternoon") :
         _(L"Good evening");
@@ -390,28 +3655,25 @@ wxString wxStartPage::FormatGreeting() const
 //---------------------------------------------------
 void wxStartPage::CalcMRUColumnHeaderHeight(wxDC& dc)
 {
-    const wxDCFontChanger fc(dc, dc.GetFont().Larger().Larger().Bold());
-    m_fileColumnHeaderHeight = dc.GetTextExtent(GetRecentLabel()).GetHeight() +
+    m_fileColumnHeaderHeight =
+        MeasureText(dc, PageFont::Greeting, GetRecentLabel()).GetHeight() +
         (2 * GetLabelPaddingHeight());
 
-    const auto greeting{ FormatGreeting() };
+    const wxString& greeting{ GetGreeting() };
     if (!greeting.empty())
     {
-        m_fileColumnHeaderHeight += dc.GetTextExtent(greeting).GetHeight() +
+        m_fileColumnHeaderHeight += MeasureText(dc, PageFont::Greeting, greeting).GetHeight() +
             (2 * GetLabelPaddingHeight());
     }
+    m_fileColumnHeaderHeight += GetFileFilterHeight();
 }
 
 //---------------------------------------------------
 void wxStartPage::CalcButtonStart(wxDC& dc)
 {
-    wxCoord appNameWidth{ 0 }, appNameHeight{ 0 },
-        appDescWidth{ 0 }, appDescHeight{ 0 };
-    {
-        const wxDCFontChanger fc(dc, m_logoFont);
-        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
-        dc.GetTextExtent(wxTheApp->GetAppName(), &appNameWidth, &appNameHeight);
-    }
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
+    const wxCoord appNameHeight{
+        MeasureText(dc, PageFont::Logo, wxTheApp->GetAppName()).GetHeight() };
 
     if (m_appHeaderStyle == wxStartPageAppHeaderStyle::wxStartPageNoHeader)
     {
@@ -427,50 +3689,61 @@ void wxStartPage::CalcButtonStart(wxDC& dc)
             GetTopBorder() + (2 * GetLabelPaddingHeight()) + appNameHeight;
         if (!m_productDescription.empty())
         {
-            dc.GetTextExtent(m_productDescription, &appDescWidth, &appDescHeight);
-            m_buttonsStart += appDescHeight + (2 * GetLabelPaddingHeight());
+            m_buttonsStart += MeasureText(dc, PageFont::Normal, m_productDescription).GetHeight() +
+                (2 * GetLabelPaddingHeight());
         }
     }
 }
 
 //---------------------------------------------------
-void wxStartPage::OnResize([[maybe_unused]] wxSizeEvent& event)
+void wxStartPage::CalcMRUButtonHeight(wxDC& dc)
 {
-    wxClientDC dc(this);
+    // the "clear file list" button under the rows
+    m_fileListButtonHeight =
+        MeasureText(dc, PageFont::Larger, GetClearFileListLabel()).GetHeight() +
+        (GetLabelPaddingHeight() * 2);
 
-    wxCoord appNameWidth{ 0 }, appNameHeight{ 0 };
-    {
-        const wxDCFontChanger fc(dc, m_logoFont);
-        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
-        dc.GetTextExtent(wxTheApp->GetAppName(), &appNameWidth, &appNameHeight);
-    }
+    // measure a sample label if the rows' labels haven't been built yet
+    const wxString sampleLabel = (!m_fileButtons.empty() && !m_fileButtons[0].m_label.empty()) ?
+        m_fileButtons[0].m_label : GetBrowseForFileLabel();
+    const auto line2TextSz = MeasureText(dc, PageFont::Larger, sampleLabel);
+    const auto line1TextSz = MeasureText(dc, PageFont::Largest, sampleLabel);
+
+    // enough space for the text (label and path) height
+    // (or icon, whichever is larger) and some padding around it
+    m_mruButtonHeight =
+        std::max(line1TextSz.GetHeight() + line2TextSz.GetHeight(),
+            GetButtonSize().GetHeight()) +
+        (2 * GetLabelPaddingHeight()) +
+        // line space between file name and path
+        wxRound(GetLabelPaddingHeight() * 0.5);
+}
 
-    CalcButtonStart(dc);
-    CalcMRUColumnHeaderHeight(dc);
+//---------------------------------------------------
+void wxStartPage::CalcButtonSizes(wxDC& dc)
+{
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
+    const wxCoord appNameWidth{
+        MeasureText(dc, PageFont::Logo, wxTheApp->GetAppName()).GetWidth() };
 
     // calculate how wide the buttons/top label need to be fit their content
     const auto buttonIconSize = GetButtonSize();
     m_buttonHeight = buttonIconSize.GetHeight() + (2 * GetLabelPaddingHeight());
     {
-        m_buttonWidth = std::max(m_buttonWidth,
+        m_buttonWidth = std::max(FromDIP(wxSize(200, 200)).GetWidth(),
             (m_logo.IsOk() ?
                 (appNameWidth + GetAppLogoSize().GetWidth() + (2 * GetLabelPaddingWidth())) :
                 appNameWidth + (2 * GetLabelPaddingWidth())));
 
-        const wxDCFontChanger fc(dc, m_buttons.size() > MAX_BUTTONS_SMALL_SIZE ?
-            dc.GetFont() :
-            dc.GetFont().Larger());
-        wxCoord textWidth{ 0 }, textHeight{ 0 };
-
         for (const auto& button : m_buttons)
         {
-            dc.GetTextExtent(button.m_label, &textWidth, &textHeight);
+            const wxSize textSize{ MeasureText(dc, GetButtonFont(), StripMnemonic(button.m_label)) };
             m_buttonWidth =
                 std::max(m_buttonWidth,
-                    textWidth +
+                    textSize.GetWidth() +
                     (4 * GetLabelPaddingWidth()) + buttonIconSize.GetWidth());
             m_buttonHeight = std::max(m_buttonHeight,
-                textHeight + (2 * GetLabelPaddingWidth()));
+                textSize.GetHeight() + (2 * GetLabelPaddingWidth()));
             if (button.m_icon.IsOk())
             {
                 m_buttonHeight =
@@ -480,137 +3753,307 @@ void wxStartPage::OnResize([[maybe_unused]] wxSizeEvent& event)
             }
         }
     }
-    // initialize the buttons
+
     for (size_t i = 0; i < m_buttons.size(); ++i)
     {
-        m_buttons[i].m_id = ID_BUTTON_ID_START + i;
         m_buttons[i].m_rect = wxRect(GetLeftBorder(),
             m_buttonsStart + (i * m_buttonHeight),
             m_buttonWidth,
             m_buttonHeight);
     }
-
-    // calculate MRU info
-    {
-        const wxDCFontChanger fc(dc, dc.GetFont().Larger());
-        if (!m_fileButtons.empty())
-        {
-            const auto line2TextSz = dc.GetTextExtent(m_fileButtons[0].m_label);
-            const wxDCFontChanger fc2(dc, wxFont(dc.GetFont()).MakeLarger());
-            const auto line1TextSz = dc.GetTextExtent(m_fileButtons[0].m_label);
-
-            // enough space for the text (label and path) height
-            // (or icon, whichever is larger) and some padding around it
-            m_mruButtonHeight =
-                std::max(line1TextSz.GetHeight() + line2TextSz.GetHeight(),
-                    buttonIconSize.GetHeight()) +
-                (2 * GetLabelPaddingHeight()) +
-                // line space between file name and path
-                wxRound(GetLabelPaddingHeight() * 0.5);
-        }
-    }
 }
 
 //---------------------------------------------------
-void wxStartPage::OnPaintWindow([[maybe_unused]] wxPaintEvent& event)
+void wxStartPage::CalcPageAreas()
 {
-    wxAutoBufferedPaintDC adc(this);
-    adc.Clear();
-    wxGCDC dc(adc);
-
-    const auto buttonIconSize = GetButtonSize();
-    CalcButtonStart(dc);
-    CalcMRUColumnHeaderHeight(dc);
-
-    const wxColour buttonAreaFontColor =
-        BlackOrWhiteContrast(GetButtonAreaBackgroundColor());
-    const wxColour mruFontColor =
-        BlackOrWhiteContrast(GetMRUBackgroundColor());
-    const wxColour buttonAreaHoverColor =
-        ShadeOrTint(GetButtonAreaBackgroundColor());
-    const wxColour mruHoverColor =
-        ShadeOrTint(GetMRUBackgroundColor());
-    const wxColour buttonAreaHoverFontColor =
-        BlackOrWhiteContrast(buttonAreaHoverColor);
-    const wxColour mruFontHoverColor =
-        BlackOrWhiteContrast(mruHoverColor);
-    const wxColour mruSeparatorLineColor =
-        ShadeOrTint(GetMRUBackgroundColor());
-
-    // calculate the positions of the buttons in the files area
-    const wxRect filesArea = wxRect(m_buttonWidth + (GetLeftBorder() * 2),
+    const wxSize clientSize{ GetPageSize() };
+    m_filesArea = wxRect(m_buttonWidth + (GetLeftBorder() * 2),
         0,
-        GetClientSize().GetWidth() - (m_buttonWidth + (GetLeftBorder() * 2)),
-        GetClientSize().GetHeight());
-    const wxRect buttonsArea =
-        wxRect(wxSize(GetClientSize().GetWidth() - filesArea.GetWidth(),
-            GetClientSize().GetHeight()));
+        clientSize.GetWidth() - (m_buttonWidth + (GetLeftBorder() * 2)),
+        clientSize.GetHeight());
+    m_buttonsArea =
+        wxRect(wxSize(clientSize.GetWidth() - m_filesArea.GetWidth(),
+            clientSize.GetHeight()));
 
+    // (the search box, if shown, is under the header)
     const wxRect fileColumnHeader =
-        wxRect(filesArea.GetLeft(), 0,
-            filesArea.GetWidth(), m_fileColumnHeaderHeight);
-    wxRect greetingRect{ fileColumnHeader }, recentRect{ fileColumnHeader };
-
-    const auto greeting{ FormatGreeting() };
-    if (!greeting.empty())
+        wxRect(m_filesArea.GetLeft(), 0,
+            m_filesArea.GetWidth(), m_fileColumnHeaderHeight - GetFileFilterHeight());
+    m_greetingRect = m_recentRect = fileColumnHeader;
+    if (!GetGreeting().empty())
     {
-        greetingRect.SetHeight(wxRound(fileColumnHeader.GetHeight() * 0.5));
-        recentRect.SetTop(greetingRect.GetBottom());
-        recentRect.SetHeight(wxRound(fileColumnHeader.GetHeight() * 0.5));
+        m_greetingRect.SetHeight(wxRound(fileColumnHeader.GetHeight() * 0.5));
+        m_recentRect.SetTop(m_greetingRect.GetBottom());
+        m_recentRect.SetHeight(wxRound(fileColumnHeader.GetHeight() * 0.5));
     }
     else
     {
-        greetingRect.SetSize(wxSize(0, 0));
+        m_greetingRect.SetSize(wxSize(0, 0));
     }
+}
 
+//---------------------------------------------------
+void wxStartPage::CalcFileListButtonRect(wxDC& dc)
+{
     if (GetMRUFileCount() > 0)
     {
-        // update the rects for the file buttons
-        for (size_t i = 0; i < GetMRUFileCount(); ++i)
-        {
-            m_fileButtons[i].m_rect =
-                wxRect(filesArea.GetLeft() + FromDIP(1),
-                    m_fileColumnHeaderHeight + (i * GetMRUButtonHeight()),
-                    filesArea.GetWidth() - FromDIP(2),
-                    GetMRUButtonHeight());
-        }
-        // the "clear file list" button
-        {
-            const wxDCFontChanger fc(dc, wxFont(dc.GetFont()).MakeLarger());
-            const auto clearButtonSize = dc.GetTextExtent(GetClearFileListLabel());
-            m_fileButtons[GetMRUFileAndClearButtonCount() - 1].m_rect =
-                wxRect(filesArea.GetLeft() + FromDIP(1),
-                    m_fileColumnHeaderHeight +
-                    ((GetMRUFileAndClearButtonCount() - 1) * GetMRUButtonHeight()),
-                    clearButtonSize.GetWidth() + (GetLabelPaddingHeight() * 2),
-                    clearButtonSize.GetHeight() + (GetLabelPaddingHeight() * 2));
-        }
+        // the "clear file list" button, under the rows (even if the list is scrolled)
+        const auto clearButtonSize =
+            MeasureText(dc, PageFont::Larger, StripMnemonic(m_fileListButton.m_label));
+        m_fileListButton.m_rect =
+            wxRect(m_filesArea.GetLeft() + FromDIP(1),
+                GetFileRowsViewRect().GetBottom() + 1,
+                clearButtonSize.GetWidth() + (GetLabelPaddingHeight() * 2),
+                clearButtonSize.GetHeight() + (GetLabelPaddingHeight() * 2));
     }
-    else if (GetMRUFileAndClearButtonCount() > 0 && IsBrowseId(m_fileButtons[0].m_id))
+    else if (IsBrowseId(m_fileListButton.m_id))
     {
         // update the browse button rect
-        const wxDCFontChanger fc(dc, wxFont(dc.GetFont()).MakeLarger());
-        const wxSize textSz = dc.GetTextExtent(m_fileButtons[0].m_label);
-        const wxSize iconSz = m_fileButtons[0].m_icon.GetBitmap(ScaleToContentSize(buttonIconSize)).GetLogicalSize();
+        const wxSize textSz =
+            MeasureText(dc, PageFont::Larger, StripMnemonic(m_fileListButton.m_label));
+        const wxSize iconSz = GetRenderedBitmap(m_fileListButton.m_icon,
+            m_fileListButton.m_renderedIcon, GetButtonSize()).GetLogicalSize();
         const auto browseButtonSize = wxSize(textSz.x + iconSz.x + GetLabelPaddingWidth(),
                                              std::max(textSz.y, iconSz.y));
 
-        m_fileButtons[0].m_rect =
-            wxRect(filesArea.GetLeft() + FromDIP(1),
+        m_fileListButton.m_rect =
+            wxRect(m_filesArea.GetLeft() + FromDIP(1),
                 m_fileColumnHeaderHeight + (3 * GetLabelPaddingHeight()) +
-                dc.GetTextExtent(GetNoRecentFilesLabel()).GetHeight(),
+                MeasureText(dc, PageFont::Larger, GetNoRecentFilesLabel()).GetHeight(),
                 browseButtonSize.GetWidth() + (GetLabelPaddingHeight() * 2),
                 browseButtonSize.GetHeight() + (GetLabelPaddingHeight() * 2));
     }
+}
+
+//---------------------------------------------------
+void wxStartPage::CalcFileLabelWidths(wxDC& dc)
+{
+    // Get the widest file modified time label so that we can draw
+    // them ragged right. Also, get the longest file path to make
+    // sure the time and path don't overlap.
+    // (this is also where the paths' labels are simplified)
+    const TraceSpan span{ "CalcFileLabelWidths" };
+    const wxDateTime now{ GetCurrentTime() };
+    m_filePathLabelWidth = m_timeLabelWidth = 0;
+    const auto [firstRow, lastRow] = GetVisibleFileRows();
+    for (size_t i = firstRow; i < lastRow; ++i)
+    {
+        auto& fileButton = m_fileButtons[GetFileRowEntry(i)];
+        // the path labels are built once their rows are scrolled into view
+        if (fileButton.m_label.empty())
+        {
+            fileButton.m_label = SimplifyFilePath(fileButton.m_fullFilePath);
+        }
+        const wxString& modTimeStr = GetFileTimeLabel(fileButton, now);
+        if (!modTimeStr.empty())
+        {
+            m_timeLabelWidth =
+                std::max(m_timeLabelWidth, MeasureText(dc, PageFont::Normal, modTimeStr).GetWidth());
+        }
+        const wxFileName fn(fileButton.m_fullFilePath);
+        m_filePathLabelWidth =
+            std::max(m_filePathLabelWidth, MeasureText(dc, PageFont::Normal, fn.GetPath()).GetWidth());
+    }
+    ScheduleTimeLabelRefresh(now);
+}
 
-    // update the custom buttons' rects
-    for (size_t i = 0; i < m_buttons.size(); ++i)
+//---------------------------------------------------
+void wxStartPage::UpdateLayout(wxDC& dc, const uint8_t parts /*= LAYOUT_ALL*/)
+{
+    if ((m_layoutDirty & parts) == 0)
     {
-        m_buttons[i].m_rect = wxRect(GetLeftBorder(),
-            m_buttonsStart + (i * m_buttonHeight),
-            m_buttonWidth,
-            m_buttonHeight);
+        return;
+    }
+    const StatsTimer timer{ m_statsEnabled, m_stats.m_layout };
+    const TraceSpan span{ "UpdateLayout" };
+
+    if ((m_layoutDirty & parts & LAYOUT_BUTTON_AREA) != 0)
+    {
+        CalcButtonStart(dc);
+        CalcButtonSizes(dc);
+        // the icons may be a different size now
+        PrepareBitmaps();
+        // the MRU list starts where the buttons end
+        m_layoutDirty |= LAYOUT_FILE_AREA;
+        m_backdropDirty = true;
+    }
+    if ((m_layoutDirty & parts & LAYOUT_FILE_AREA) != 0)
+    {
+        CalcMRUColumnHeaderHeight(dc);
+        CalcMRUButtonHeight(dc);
+        CalcPageAreas();
+        // different rows may fit now
+        m_layoutDirty |= LAYOUT_FILE_ROWS;
+        m_backdropDirty = true;
+    }
+    if ((m_layoutDirty & parts & LAYOUT_FILE_ROWS) != 0)
+    {
+        CalcFileListButtonRect(dc);
+        CalcFileLabelWidths(dc);
+    }
+    m_layoutDirty = static_cast<uint8_t>(m_layoutDirty & ~parts);
+}
+
+//---------------------------------------------------
+const wxBitmap& wxStartPage::GetRenderedBitmap(const wxBitmapBundle& bundle,
+                                               RenderedBitmap& rendered, const wxSize size)
+{
+    const double scaleFactor{ GetPageScaleFactor() };
+    const bool upToDate{ rendered.m_size == size && rendered.m_scaleFactor == scaleFactor };
+    CountCacheLookup(m_stats.m_bitmapCache, upToDate);
+    if (!upToDate)
+    {
+        rendered.m_bitmap = bundle.IsOk() ?
+            bundle.GetBitmap(ScaleToContentSize(size)) : wxNullBitmap;
+        if (rendered.m_bitmap.IsOk())
+        {
+            rendered.m_bitmap.SetScaleFactor(scaleFactor);
+        }
+        rendered.m_size = size;
+        rendered.m_scaleFactor = scaleFactor;
+    }
+    return rendered.m_bitmap;
+}
+
+//---------------------------------------------------
+wxBitmapBundle wxStartPage::CreateArtBundle(const wxArtID& artId)
+{
+    return wxBitmapBundle::FromImpl(new ArtBundleImpl{ artId, wxART_BUTTON });
+}
+
+//---------------------------------------------------
+void wxStartPage::PrepareBitmaps()
+{
+    GetRenderedBitmap(m_logo, m_renderedLogo, GetAppLogoSize());
+    GetRenderedBitmap(m_logo, m_renderedFileIcon, GetFileIconSize());
+    for (auto& button : m_buttons)
+    {
+        GetRenderedBitmap(button.m_icon, button.m_renderedIcon, GetButtonSize());
+    }
+    GetRenderedBitmap(m_fileListButton.m_icon, m_fileListButton.m_renderedIcon, GetButtonSize());
+}
+
+//---------------------------------------------------
+bool wxStartPage::SetFont(const wxFont& font)
+{
+    if (!wxWindow::SetFont(font))
+    {
+        return false;
+    }
+    BuildPageFonts();
+    InvalidateLayout(LAYOUT_ALL);
+    SendSizeEvent();
+    Refresh();
+    return true;
+}
+
+//---------------------------------------------------
+void wxStartPage::OnDPIChanged(wxDPIChangedEvent& event)
+{
+    BuildPageFonts();
+    PrepareBitmaps();
+    InvalidateLayout(LAYOUT_ALL);
+    Refresh();
+    event.Skip();
+}
+
+//---------------------------------------------------
+void wxStartPage::OnResize([[maybe_unused]] wxSizeEvent& event)
+{
+    const StatsTimer timer{ m_statsEnabled, m_stats.m_resize };
+    const TraceSpan span{ "OnResize" };
+    // While the window is being resized, the paints draw the backdrop straight to the
+    // window (rather than caching it at every size), until the resizing settles.
+    m_resizeSettleTimer.Start(static_cast<int>(RESIZE_SETTLE_DELAY.count()), wxTIMER_ONE_SHOT);
+
+    if ((m_layoutDirty & (LAYOUT_BUTTON_AREA | LAYOUT_FILE_AREA)) != 0)
+    {
+        // (the rows' labels are measured when they are drawn)
+        wxClientDC clientDC(this);
+        std::optional<wxGCDC> gcdc;
+        wxDC& dc = IsUsingGCDC() ? static_cast<wxDC&>(gcdc.emplace(clientDC)) : clientDC;
+        UpdateLayout(dc, LAYOUT_BUTTON_AREA | LAYOUT_FILE_AREA);
     }
+    else
+    {
+        // The text and buttons are measured the same at any size, so only the areas
+        // that depend on the size are moved (no DC is needed for that).
+        CalcPageAreas();
+        InvalidateLayout(LAYOUT_FILE_ROWS);
+    }
+
+    // the search box goes under the header, across the files area
+    if (m_searchCtrl != nullptr)
+    {
+        const wxCoord searchHeight = m_searchCtrl->GetBestSize().GetHeight();
+        m_searchCtrl->SetSize(m_filesArea.GetLeft() + GetLabelPaddingWidth(),
+            m_fileColumnHeaderHeight - searchHeight - GetLabelPaddingHeight(),
+            std::max<wxCoord>(0, m_filesArea.GetWidth() - (2 * GetLabelPaddingWidth())),
+            searchHeight);
+    }
+
+    // the list may not need to scroll as far now, and more (or other) rows may be in view
+    m_fileScrollPosition = std::min(m_fileScrollPosition, GetMaxFileScrollPosition());
+    ProbeVisibleRows();
+}
+
+//---------------------------------------------------
+void wxStartPage::OnResizeSettled([[maybe_unused]] wxTimerEvent& event)
+{
+    // the window already shows the page at this size, but cache the backdrop
+    // now so that the next (e.g., hover) paint doesn't have to
+    if (!IsBackdropCurrent() && (m_layoutDirty & (LAYOUT_BUTTON_AREA | LAYOUT_FILE_AREA)) == 0)
+    {
+        UpdateBackdrop();
+    }
+}
+
+//---------------------------------------------------
+bool wxStartPage::IsBackdropCurrent()
+{
+    return !m_backdropDirty && m_backdrop.IsOk() &&
+        m_backdrop.GetLogicalSize() == GetPageSize() &&
+        m_backdrop.GetScaleFactor() == GetPageScaleFactor() &&
+        m_backdropGreeting == GetGreeting();
+}
+
+//---------------------------------------------------
+void wxStartPage::UpdateBackdrop()
+{
+    const StatsTimer timer{ m_statsEnabled, m_stats.m_paintBackdrop };
+    const TraceSpan span{ "UpdateBackdrop" };
+    m_backdropDirty = false;
+    m_backdropGreeting = GetGreeting();
+
+    const wxSize clientSize{ GetPageSize() };
+    if (clientSize.GetWidth() <= 0 || clientSize.GetHeight() <= 0)
+    {
+        m_backdrop = wxBitmap{};
+        return;
+    }
+    if (!m_backdrop.IsOk() || m_backdrop.GetLogicalSize() != clientSize ||
+        m_backdrop.GetScaleFactor() != GetPageScaleFactor())
+    {
+        m_backdrop = wxBitmap{};
+        m_backdrop.CreateWithDIPSize(clientSize, GetPageScaleFactor());
+    }
+
+    wxMemoryDC memDC(m_backdrop);
+    std::optional<wxGCDC> gcdc;
+    wxDC& dc = IsUsingGCDC() ? static_cast<wxDC&>(gcdc.emplace(memDC)) : memDC;
+    dc.SetFont(GetPageFont(PageFont::Normal));
+    DrawBackdrop(dc);
+}
+
+//---------------------------------------------------
+void wxStartPage::DrawBackdrop(wxDC& dc)
+{
+    const wxColour buttonAreaFontColor =
+        BlackOrWhiteContrast(GetButtonAreaBackgroundColor());
+    const wxColour mruFontColor =
+        BlackOrWhiteContrast(GetMRUBackgroundColor());
+    const wxColour mruSeparatorLineColor =
+        ShadeOrTint(GetMRUBackgroundColor());
 
     // fill the background
     dc.SetBackground(GetButtonAreaBackgroundColor());
@@ -619,26 +4062,27 @@ void wxStartPage::OnPaintWindow([[maybe_unused]] wxPaintEvent& event)
     // draw the program logo
     if (m_appHeaderStyle != wxStartPageAppHeaderStyle::wxStartPageNoHeader)
     {
+        const TraceSpan span{ "DrawAppHeader" };
         wxCoord appDescWidth{ 0 }, appDescHeight{ 0 };
         if (!m_productDescription.empty())
         {
-            dc.GetTextExtent(m_productDescription, &appDescWidth, &appDescHeight);
-            appDescHeight += (2 * GetLabelPaddingHeight());
+            const wxSize appDescSize{ MeasureText(dc, PageFont::Normal, m_productDescription) };
+            appDescWidth = appDescSize.GetWidth();
+            appDescHeight = appDescSize.GetHeight() + (2 * GetLabelPaddingHeight());
         }
         const wxDCTextColourChanger cc(dc, buttonAreaFontColor);
         const wxDCPenChanger pc(dc, buttonAreaFontColor);
-        wxCoord textWidth{ 0 }, textHeight{ 0 };
-        wxBitmap appLogo = m_logo.GetBitmap(ScaleToContentSize(GetAppLogoSize()));
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
+        const wxSize appNameSize{ MeasureText(dc, PageFont::Logo, wxTheApp->GetAppName()) };
+        const wxCoord textWidth{ appNameSize.GetWidth() }, textHeight{ appNameSize.GetHeight() };
+        const wxBitmap& appLogo = GetRenderedBitmap(m_logo, m_renderedLogo, GetAppLogoSize());
         if (m_appHeaderStyle == wxStartPageAppHeaderStyle::wxStartPageAppNameAndLogo &&
             appLogo.IsOk())
         {
-            appLogo.SetScaleFactor(GetContentScaleFactor());
             dc.DrawBitmap(appLogo, GetLeftBorder(), GetTopBorder());
             // draw with larger font
             {
-                const wxDCFontChanger fc(dc, m_logoFont);
-                // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
-                dc.GetTextExtent(wxTheApp->GetAppName(), &textWidth, &textHeight);
+                const wxDCFontChanger fc(dc, GetPageFont(PageFont::Logo));
                 // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
                 dc.DrawText(wxTheApp->GetAppName(),
                     GetLeftBorder() + appLogo.GetLogicalWidth() + GetLabelPaddingWidth(),
@@ -661,13 +4105,11 @@ void wxStartPage::OnPaintWindow([[maybe_unused]] wxPaintEvent& event)
         {
             // draw with larger font
             {
-                const wxDCFontChanger fc(dc, m_logoFont);
-                // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
-                dc.GetTextExtent(wxTheApp->GetAppName(), &textWidth, &textHeight);
+                const wxDCFontChanger fc(dc, GetPageFont(PageFont::Logo));
                 // centering looks better when there is no logo
                 // NOLINTNEXTLINE(cppcoreguidelines-pro-type-static-cast-downcast)
                 dc.DrawText(wxTheApp->GetAppName(),
-                    (buttonsArea.GetWidth() - textWidth) * 0.5,
+                    (m_buttonsArea.GetWidth() - textWidth) * 0.5,
                     GetTopBorder() + GetLabelPaddingHeight());
             }
             if (!m_productDescription.empty())
@@ -685,92 +4127,296 @@ void wxStartPage::OnPaintWindow([[maybe_unused]] wxPaintEvent& event)
         }
     }
 
-    // draw the MRU files area
+    // draw the MRU files area
+    {
+        const wxDCPenChanger pc(dc, *wxTRANSPARENT_PEN);
+        const wxDCBrushChanger bc(dc, GetMRUBackgroundColor());
+        dc.DrawRectangle(m_filesArea);
+        // if areas have the same color, then draw a contrasting line between them
+        if (GetMRUBackgroundColor() == GetButtonAreaBackgroundColor())
+        {
+            const wxDCPenChanger pc2(dc, ShadeOrTint(GetMRUBackgroundColor()));
+            dc.DrawLine(m_filesArea.GetTopLeft(), m_filesArea.GetBottomLeft());
+        }
+    }
+    // draw the greeting
+    {
+        const TraceSpan span{ "DrawGreeting" };
+        const wxDCTextColourChanger tcc(dc, mruFontColor);
+        const wxDCPenChanger pc(dc, mruSeparatorLineColor);
+        dc.SetClippingRegion(m_greetingRect);
+        DrawPageLabel(dc, PageFont::Greeting, m_backdropGreeting, wxNullBitmap,
+            wxRect(m_greetingRect).Deflate(GetLabelPaddingWidth()),
+            wxALIGN_LEFT);
+        dc.DestroyClippingRegion();
+        dc.DrawLine(m_greetingRect.GetLeftBottom(),
+            m_greetingRect.GetRightBottom());
+    }
+    // draw MRU column header
+    {
+        const TraceSpan span{ "DrawColumnHeader" };
+        const wxDCTextColourChanger tcc(dc, mruFontColor);
+        const wxDCPenChanger pc(dc,
+            wxPen(wxPenInfo(mruSeparatorLineColor,
+                FromDIP(2)).Cap(wxPenCap::wxCAP_BUTT)));
+        dc.SetClippingRegion(m_recentRect);
+        DrawPageLabel(dc, PageFont::Largest, GetRecentLabel(), wxNullBitmap,
+            wxRect(m_recentRect).Deflate(GetLabelPaddingWidth()),
+            wxALIGN_CENTRE);
+        dc.DestroyClippingRegion();
+        auto midPoint = m_recentRect.GetLeftBottom();
+        midPoint.x += wxRound((m_recentRect.GetRightBottom().x - m_recentRect.GetLeftBottom().x) * 0.5);
+        const wxSize recentTextSz{ MeasureText(dc, PageFont::Largest, GetRecentLabel()) };
+        dc.DrawLine(midPoint -
+            wxSize(wxRound(recentTextSz.GetWidth() * 0.5), 0),
+            midPoint +
+            wxSize(wxRound(recentTextSz.GetWidth() * 0.5), 0));
+    }
+}
+
+//---------------------------------------------------
+void wxStartPage::EnableTracing(const bool enable /*= true*/) noexcept
+{
+    StartPageTracer::Get().Enable(enable);
+}
+
+//---------------------------------------------------
+bool wxStartPage::IsTracingEnabled() noexcept
+{
+    return StartPageTracer::Get().IsEnabled();
+}
+
+//---------------------------------------------------
+bool wxStartPage::WriteTrace(const wxString& filePath)
+{
+    return StartPageTracer::Get().Write(filePath);
+}
+
+//---------------------------------------------------
+void wxStartPage::LogStats() const
+{
+    const auto logTiming = [](const wxString& name, const wxStartPageStats::Timing& timing)
+        {
+            const double totalMs{
+                std::chrono::duration<double, std::milli>(timing.m_total).count() };
+            wxLogTrace(STATS_TRACE_MASK,
+                L"%s: %llu calls, %.3f ms total, %.3f ms average, %.3f ms max",
+                name, timing.m_count, totalMs,
+                (timing.m_count > 0) ? totalMs / static_cast<double>(timing.m_count) : 0.0,
+                std::chrono::duration<double, std::milli>(timing.m_max).count());
+        };
+    const auto logCache = [](const wxString& name, const wxStartPageStats::CacheCounter& cache)
+        {
+            wxLogTrace(STATS_TRACE_MASK, L"%s cache: %.1f%% hits (%llu hits, %llu misses)",
+                       name, cache.GetHitRate() * 100, cache.m_hits, cache.m_misses);
+        };
+
+    wxString latencies;
+    for (size_t i = 0; i < m_stats.m_fileProbeLatencies.size(); ++i)
+    {
+        latencies += (i < wxStartPageStats::PROBE_LATENCY_LIMITS.size()) ?
+            wxString::Format(L" <%lldms: %llu;",
+                static_cast<long long>(wxStartPageStats::PROBE_LATENCY_LIMITS[i].count()),
+                m_stats.m_fileProbeLatencies[i]) :
+            wxString::Format(L" slower: %llu", m_stats.m_fileProbeLatencies[i]);
+    }
+    wxLogTrace(STATS_TRACE_MASK, L"File probes: %llu started, %llu timed out;%s",
+               m_stats.m_fileProbes, m_stats.m_fileProbeTimeouts, latencies);
+    logTiming(L"SetMRUList", m_stats.m_setMRUList);
+    logTiming(L"Layout", m_stats.m_layout);
+    logTiming(L"Resize", m_stats.m_resize);
+    logTiming(L"Paint", m_stats.m_paint);
+    logTiming(L"Paint (backdrop)", m_stats.m_paintBackdrop);
+    logTiming(L"Paint (backdrop copy)", m_stats.m_paintBlit);
+    logTiming(L"Paint (rows and buttons)", m_stats.m_paintOverlay);
+    wxLogTrace(STATS_TRACE_MASK, L"Paints: %llu from hovering, %llu from content changes, "
+               "%llu from the system (%.1f per second)",
+               m_stats.m_hoverPaints, m_stats.m_contentPaints, m_stats.m_systemPaints,
+               m_stats.GetPaintsPerSecond());
+    wxLogTrace(STATS_TRACE_MASK, L"Mouse moves: %llu coalesced", m_stats.m_coalescedMouseMoves);
+    logTiming(L"Hover latency", m_stats.m_hoverLatency);
+    logCache(L"Text extent", m_stats.m_textExtentCache);
+    logCache(L"Time label", m_stats.m_timeLabelCache);
+    logCache(L"Bitmap", m_stats.m_bitmapCache);
+    logCache(L"Backdrop", m_stats.m_backdropCache);
+}
+
+//---------------------------------------------------
+void wxStartPage::OnPaintWindow([[maybe_unused]] wxPaintEvent& event)
+{
+    const TraceSpan span{ "OnPaintWindow" };
+    // Only what intersects the invalidated area is drawn
+    // (e.g., a hover change only redraws the rows whose highlight changed).
+    wxRegion updateRegion{ GetUpdateRegion() };
+    if (updateRegion.IsEmpty())
+    {
+        updateRegion = wxRegion{ wxRect{ GetClientSize() } };
+    }
+
+    if (m_statsEnabled)
     {
-        const wxDCPenChanger pc(dc, wxColour{ 0, 0, 0, 0 });
-        const wxDCBrushChanger bc(dc, GetMRUBackgroundColor());
-        dc.DrawRectangle(filesArea);
-        // if areas have the same color, then draw a contrasting line between them
-        if (GetMRUBackgroundColor() == GetButtonAreaBackgroundColor())
+        ++((m_pendingPaints & PAINT_CONTENT) != 0 ? m_stats.m_contentPaints :
+           (m_pendingPaints & PAINT_HOVER) != 0 ? m_stats.m_hoverPaints :
+           m_stats.m_systemPaints);
+        if ((m_pendingPaints & PAINT_HOVER) != 0 &&
+            m_hoverStart != std::chrono::steady_clock::time_point{})
         {
-            const wxDCPenChanger pc2(dc, ShadeOrTint(GetMRUBackgroundColor()));
-            dc.DrawLine(filesArea.GetTopLeft(), filesArea.GetBottomLeft());
+            m_stats.m_hoverLatency.Add(std::chrono::steady_clock::now() - m_hoverStart);
         }
     }
-    // draw the greeting
+    m_hoverStart = std::chrono::steady_clock::time_point{};
+    m_pendingPaints = 0;
+
+    [[maybe_unused]] const wxString currentToolTip = m_toolTip;
     {
-        const wxDCFontChanger fc(dc, dc.GetFont().Larger().Larger().Bold());
-        const wxDCTextColourChanger tcc(dc, mruFontColor);
-        const wxDCPenChanger pc(dc, mruSeparatorLineColor);
-        dc.SetClippingRegion(greetingRect);
-        dc.DrawLabel(greeting,
-            wxRect(greetingRect).Deflate(GetLabelPaddingWidth()),
-            wxALIGN_LEFT);
-        dc.DestroyClippingRegion();
-        dc.DrawLine(greetingRect.GetLeftBottom(),
-            greetingRect.GetRightBottom());
+        wxAutoBufferedPaintDC adc(this);
+        std::optional<wxGCDC> gcdc;
+        wxDC& dc = IsUsingGCDC() ? static_cast<wxDC&>(gcdc.emplace(adc)) : adc;
+        DrawPage(dc, updateRegion);
     }
-    // draw MRU column header
+
+    // don't use tooltips with GTK, they only appear randomly and cause painting issues
+#ifndef __WXGTK__
+    if (currentToolTip != m_toolTip)
     {
-        const wxDCFontChanger fc(dc, dc.GetFont().Larger().Larger());
-        const wxDCTextColourChanger tcc(dc, mruFontColor);
-        const wxDCPenChanger pc(dc,
-            wxPen(wxPenInfo(mruSeparatorLineColor,
-                FromDIP(2)).Cap(wxPenCap::wxCAP_BUTT)));
-        dc.SetClippingRegion(recentRect);
-        dc.DrawLabel(GetRecentLabel(),
-            wxRect(recentRect).Deflate(GetLabelPaddingWidth()),
-            wxALIGN_CENTRE);
-        dc.DestroyClippingRegion();
-        auto midPoint = recentRect.GetLeftBottom();
-        midPoint.x += wxRound((recentRect.GetRightBottom().x - recentRect.GetLeftBottom().x) * 0.5);
-        const wxSize recentTextSz{ dc.GetTextExtent(GetRecentLabel()) };
-        dc.DrawLine(midPoint -
-            wxSize(wxRound(recentTextSz.GetWidth() * 0.5), 0),
-            midPoint +
-            wxSize(wxRound(recentTextSz.GetWidth() * 0.5), 0));
+        SetToolTip(m_toolTip);
     }
+#endif
+}
 
-    [[maybe_unused]] const wxString currentToolTip = m_toolTip;
-    // highlight the active MRU file or custom button
-    if (m_activeButton != wxNOT_FOUND)
+//---------------------------------------------------
+wxBitmap wxStartPage::RenderToBitmap(const wxSize& size, const double scaleFactor /*= 1.0*/)
+{
+    if (size.GetWidth() <= 0 || size.GetHeight() <= 0 || scaleFactor <= 0)
+    {
+        return wxNullBitmap;
+    }
+
+    wxBitmap page;
+    if (!page.CreateWithDIPSize(size, scaleFactor))
+    {
+        return wxNullBitmap;
+    }
+
+    // lay out (and draw) the page at the requested size, rather than the window's
+    m_renderSize = size;
+    m_renderScaleFactor = scaleFactor;
+    InvalidateLayout(LAYOUT_ALL);
+    {
+        wxMemoryDC memDC(page);
+        std::optional<wxGCDC> gcdc;
+        wxDC& dc = IsUsingGCDC() ? static_cast<wxDC&>(gcdc.emplace(memDC)) : memDC;
+        DrawPage(dc, wxRegion{ wxRect{ size } });
+    }
+    m_renderSize = wxDefaultSize;
+    m_renderScaleFactor = 0;
+
+    // lay the window back out now (rather than on its next paint), so that
+    // hit-testing and keyboard navigation don't use the rendered size's rects
+    InvalidateLayout(LAYOUT_ALL);
+    wxClientDC clientDC(this);
+    std::optional<wxGCDC> gcdc;
+    wxDC& dc = IsUsingGCDC() ? static_cast<wxDC&>(gcdc.emplace(clientDC)) : clientDC;
+    dc.SetFont(GetPageFont(PageFont::Normal));
+    UpdateLayout(dc);
+
+    return page;
+}
+
+//---------------------------------------------------
+void wxStartPage::DrawPage(wxDC& dc, const wxRegion& updateRegion)
+{
+    const StatsTimer timer{ m_statsEnabled, m_stats.m_paint };
+    const TraceSpan span{ "DrawPage" };
+    const auto isDamaged = [&updateRegion](const wxRect& rect)
+        { return !rect.IsEmpty() && updateRegion.Contains(rect) != wxOutRegion; };
+
+    dc.SetFont(GetPageFont(PageFont::Normal));
+
+    // (this only measures anything if something that the layout depends on changed)
+    UpdateLayout(dc);
+
+    // copy the static parts of the page from the backdrop,
+    // and then draw the rows and buttons (and highlight) over them
+    // (while resizing, the backdrop would only be good for one paint,
+    //  so it is drawn straight to the window instead)
+    bool backdropCurrent{ IsBackdropCurrent() };
+    if (!backdropCurrent && IsLiveResizing())
+    {
+        const TraceSpan backdropSpan{ "DrawBackdrop" };
+        m_backdropGreeting = GetGreeting();
+        // (the cached one is redrawn once the resizing settles)
+        m_backdropDirty = true;
+        DrawBackdrop(dc);
+    }
+    else
     {
-        wxRect buttonBorderRect;
-        ActiveButtonType activeButton{ ActiveButtonType::CustomButton };
-        for (size_t i = 0; i < GetMRUFileAndClearButtonCount(); ++i)
+        CountCacheLookup(m_stats.m_backdropCache, backdropCurrent);
+        if (!backdropCurrent)
         {
-            if (m_fileButtons[i].IsOk() &&
-                m_activeButton == m_fileButtons[i].m_id)
-            {
-                // show either full path, the label, or nothing
-                // (if a button under the MRU list)
-                m_toolTip = (i == (GetMRUFileAndClearButtonCount() - 1)) ?
-                    wxString{} :
-                    !m_fileButtons[i].m_fullFilePath.empty() ?
-                    m_fileButtons[i].m_fullFilePath : m_fileButtons[i].m_label;
-                buttonBorderRect = m_fileButtons[i].m_rect;
-                activeButton = (i == (GetMRUFileAndClearButtonCount() - 1)) ?
-                    ActiveButtonType::FileActionButton :
-                    ActiveButtonType::FileButton;
-                break;
-            }
+            UpdateBackdrop();
+            backdropCurrent = true;
         }
-        for (const auto& button : m_buttons)
+    }
+    if (backdropCurrent && m_backdrop.IsOk())
+    {
+        const StatsTimer blitTimer{ m_statsEnabled, m_stats.m_paintBlit };
+        const TraceSpan blitSpan{ "BlitBackdrop" };
+        wxMemoryDC backdropDC;
+        backdropDC.SelectObjectAsSource(m_backdrop);
+        const wxRect clientRect{ GetPageSize() };
+        for (wxRegionIterator damagedRects(updateRegion); damagedRects; ++damagedRects)
         {
-            if (m_activeButton == button.m_id)
+            const wxRect damagedRect{ damagedRects.GetRect().Intersect(clientRect) };
+            if (!damagedRect.IsEmpty())
             {
-                buttonBorderRect = button.m_rect;
-                m_toolTip.clear();
-                activeButton = ActiveButtonType::CustomButton;
-                break;
+                dc.Blit(damagedRect.GetTopLeft(), damagedRect.GetSize(),
+                        &backdropDC, damagedRect.GetTopLeft());
             }
         }
-        if (!buttonBorderRect.IsEmpty())
+    }
+
+    const StatsTimer overlayTimer{ m_statsEnabled, m_stats.m_paintOverlay };
+    const auto buttonIconSize = GetButtonSize();
+    const wxColour buttonAreaFontColor =
+        BlackOrWhiteContrast(GetButtonAreaBackgroundColor());
+    const wxColour mruFontColor =
+        BlackOrWhiteContrast(GetMRUBackgroundColor());
+    const wxColour buttonAreaHoverColor =
+        ShadeOrTint(GetButtonAreaBackgroundColor());
+    const wxColour mruHoverColor =
+        ShadeOrTint(GetMRUBackgroundColor());
+    const wxColour buttonAreaHoverFontColor =
+        BlackOrWhiteContrast(buttonAreaHoverColor);
+    const wxColour mruFontHoverColor =
+        BlackOrWhiteContrast(mruHoverColor);
+    const wxColour mruSeparatorLineColor =
+        ShadeOrTint(GetMRUBackgroundColor());
+
+    // only the rows scrolled into view get drawn
+    const wxRect fileRowsRect{ GetFileRowsViewRect() };
+    const auto [firstVisibleRow, lastVisibleRow] = GetVisibleFileRows();
+
+    // highlight the active MRU file or custom button
+    if (m_activeButton != wxNOT_FOUND)
+    {
+        const wxRect buttonBorderRect{ GetButtonRect(m_activeButton) };
+        const ActiveButtonType activeButton = IsCustomButtonId(m_activeButton) ?
+            ActiveButtonType::CustomButton :
+            IsFileListButtonId(m_activeButton) ?
+            ActiveButtonType::FileActionButton :
+            ActiveButtonType::FileButton;
+        // show either the full path or nothing (if a custom button or a button under the MRU list)
+        m_toolTip = (activeButton == ActiveButtonType::FileButton &&
+                     GetFileRow(m_activeButton) < GetFileRowCount()) ?
+            m_fileButtons[GetFileRowEntry(GetFileRow(m_activeButton))].m_fullFilePath :
+            wxString{};
+        if (isDamaged(buttonBorderRect))
         {
             if (activeButton == ActiveButtonType::FileActionButton)
             {
                 // highlight just the border so that it looks like a UI button
-                const wxDCBrushChanger bdc(dc, wxColour{ 0, 0, 0, 0 });
+                const wxDCBrushChanger bdc(dc, *wxTRANSPARENT_BRUSH);
                 const wxDCPenChanger pdc(dc,
                     wxPen(ShadeOrTint(GetMRUBackgroundColor(), 0.4), FromDIP(2)));
                 dc.DrawRectangle(buttonBorderRect);
@@ -788,254 +4434,209 @@ void wxStartPage::OnPaintWindow([[maybe_unused]] wxPaintEvent& event)
         m_toolTip.clear();
     }
 
-    // don't use tooltips with GTK, they only appear randomly and cause painting issues
-#ifndef __WXGTK__
-    if (currentToolTip != m_toolTip)
+    // file labels
     {
-        SetToolTip(m_toolTip);
-    }
-#endif
+        const TraceSpan fileRowsSpan{ "DrawFileRows" };
+        // begin drawing them
+        const wxBitmap& fileIcon = GetRenderedBitmap(m_logo, m_renderedFileIcon, GetFileIconSize());
 
-    const auto formatFileDateTime = [](const auto& dt)
+        // if empty state, draw the message
+        if (GetMRUFileCount() == 0 && IsBrowseId(m_fileListButton.m_id))
         {
-            wxString dateStr;
-            const auto currentTime{ wxDateTime::Now() };
-            const wxTimeSpan timeDiff = wxDateTime::Now().Subtract(dt);
-            if (timeDiff.GetHours() < 1)
-            {
-                if (timeDiff.GetMinutes() < 10)
-                {
-                    dateStr = _(L"Just now");
-                }
-                else
-                {
-                    dateStr = wxString::Format(_(L"%d minutes ago"),
-                        timeDiff.GetMinutes());
-                }
-            }
-            else if (timeDiff.GetMinutes() < 90)
-            {
-                dateStr = _(L"1 hour ago");
-            }
-            else if (timeDiff.GetHours() <= 8)
+            const wxDCTextColourChanger tcc(dc, mruFontColor);
+            const wxRect emptyStateMessageRect =
+                wxRect(m_filesArea.GetLeft() + GetLabelPaddingWidth(),
+                    m_fileColumnHeaderHeight + GetLabelPaddingHeight(),
+                    m_filesArea.GetWidth() - (2 * GetLabelPaddingWidth()),
+                    MeasureText(dc, PageFont::Normal, GetNoRecentFilesLabel()).GetHeight());
+            if (isDamaged(emptyStateMessageRect))
             {
-                dateStr = wxString::Format(_(L"%d hours ago"),
-                    timeDiff.GetHours() +
-                    // round the minutes
-                    ((timeDiff.GetMinutes() - (60 * timeDiff.GetHours())) < 30 ? 0 : 1));
+                DrawPageLabel(dc, PageFont::Normal, GetNoRecentFilesLabel(), wxNullBitmap,
+                    emptyStateMessageRect, wxALIGN_LEFT);
             }
-            // named day if modified sometime this week
-            else if (currentTime.GetYear() == dt.GetYear() &&
-                currentTime.GetMonth() == dt.GetMonth() &&
-                currentTime.GetWeekOfMonth() == dt.GetWeekOfMonth())
+        }
+        // or nothing matches the search text
+        else if (IsFileListFiltered() && GetFileRowCount() == 0 && isDamaged(fileRowsRect))
+        {
+            const wxDCTextColourChanger tcc(dc, mruFontColor);
+            DrawPageLabel(dc, PageFont::Normal, GetNoMatchingFilesLabel(), wxNullBitmap,
+                wxRect{ fileRowsRect }.Deflate(GetLabelPaddingWidth(), 0),
+                wxALIGN_LEFT | wxALIGN_CENTRE_VERTICAL);
+        }
+
+        // marks where the search text is in a label (drawn at the given point),
+        // so only the rows being drawn get measured
+        const wxString filterText{ m_fileFilter.Lower() };
+        // what the row being drawn is filled with (under its matches)
+        wxColour rowBackground{ GetMRUBackgroundColor() };
+        const auto drawFilterMatch =
+            [this, &dc, &filterText, &rowBackground]
+            (const PageFont font, const wxString& label, const wxPoint& pt)
             {
-                // include time, in the local clock format
-                wxString am, pm;
-                wxDateTime::GetAmPmStrings(&am, &pm);
-                wxString timeStr;
-                if (!am.empty() && !pm.empty())
-                {
-                    timeStr = dt.Format(L"%I:%M %p").MakeUpper();
-                }
-                else
+                const size_t matchPos{ label.Lower().find(filterText) };
+                if (matchPos == wxString::npos)
                 {
-                    timeStr = dt.Format(L"%H:%M");
+                    return false;
                 }
+                const wxCoord matchLeft{
+                    MeasureText(dc, font, label.substr(0, matchPos)).GetWidth() };
+                const wxSize matchSize{
+                    MeasureText(dc, font, label.substr(matchPos, filterText.length())) };
+                const wxDCPenChanger pc(dc, *wxTRANSPARENT_PEN);
+                const wxDCBrushChanger bc(dc,
+                    GetOverlayColor(wxColour{ 255, 200, 0, 110 }, rowBackground));
+                dc.DrawRectangle(wxRect{ wxPoint{ pt.x + matchLeft, pt.y }, matchSize });
+                return true;
+            };
+
+        // the "clear file list" (or "browse") button
+        if (m_fileListButton.IsOk() && isDamaged(m_fileListButton.m_rect))
+        {
+            const wxDCTextColourChanger tcc(dc,
+                m_activeButton == m_fileListButton.m_id ?
+                mruFontHoverColor : mruFontColor);
+            const wxRect buttonLabelRect =
+                wxRect{ m_fileListButton.m_rect }.Deflate(GetLabelPaddingHeight());
+            dc.SetClippingRegion(m_fileListButton.m_rect);
+            const wxBitmap& bmp = GetRenderedBitmap(m_fileListButton.m_icon,
+                                                    m_fileListButton.m_renderedIcon, buttonIconSize);
+            DrawPageLabel(dc, PageFont::Larger, m_fileListButton.m_label, bmp, buttonLabelRect,
+                          wxALIGN_LEFT | wxALIGN_CENTRE_VERTICAL, true);
+            dc.DestroyClippingRegion();
+        }
 
-                if (currentTime.GetDay() == dt.GetDay())
+        for (size_t i = firstVisibleRow; i < lastVisibleRow; ++i)
+        {
+            const wxRect rowRect{ GetFileRowRect(i) };
+            if (!isDamaged(rowRect.Intersect(fileRowsRect)))
+            {
+                continue;
+            }
+            const wxDCTextColourChanger tcc(dc,
+                m_activeButton == GetFileRowId(i) ?
+                mruFontHoverColor : mruFontColor);
+            rowBackground = (m_activeButton == GetFileRowId(i)) ?
+                mruHoverColor : GetMRUBackgroundColor();
+            const wxRect fileLabelRect =
+                wxRect{ rowRect }.Deflate(GetLabelPaddingHeight());
+            // rows at the edges may only be partially scrolled into view
+            dc.SetClippingRegion(rowRect.Intersect(fileRowsRect));
+            // show the files
+            const auto& fileButton = m_fileButtons[GetFileRowEntry(i)];
+            const wxFileName fn(fileButton.m_fullFilePath);
+            // truncate the path if necessary
+            const wxString pathLabel = (fileButton.m_label.length() <= 75) ?
+                fileButton.m_label :
+                // TRANSLATORS: "..." implies a truncated file path.
+                (fileButton.m_label.substr(0, 75) + _(L"..."));
+            if (fileIcon.IsOk())
+            {
+                dc.DrawBitmap(fileIcon,
+                    wxPoint(fileLabelRect.GetLeft(),
+                        fileLabelRect.GetTop() +
+                        wxRound((fileLabelRect.GetHeight() - fileIcon.GetLogicalHeight()) * 0.5)
+                    ));
+                int nameHeight{ 0 };
+                bool nameMatched{ false };
+                // draw the filename
                 {
-                    dateStr = wxString::Format(_(L"Today at %s"), timeStr);
+                    const wxDCFontChanger fc(dc, GetPageFont(PageFont::Larger));
+                    nameHeight =
+                        MeasureText(dc, PageFont::Larger, fn.GetFullName()).GetHeight();
+                    const wxPoint namePos{ fileLabelRect.GetLeft() +
+                        GetLabelPaddingWidth() + fileIcon.GetLogicalWidth(),
+                        fileLabelRect.GetTop() };
+                    nameMatched = IsFileListFiltered() &&
+                        drawFilterMatch(PageFont::Larger, fn.GetFullName(), namePos);
+                    dc.DrawText(fn.GetFullName(), namePos);
                 }
-                else if (currentTime.GetDay() - 1 == dt.GetDay())
+                // draw the filepath
                 {
-                    dateStr = wxString::Format(_(L"Yesterday at %s"), timeStr);
+                    const wxDCTextColourChanger cc(dc, mruFontColor);
+                    const wxPoint pathPos{ fileLabelRect.GetLeft() +
+                        GetLabelPaddingWidth() + fileIcon.GetLogicalWidth(),
+                        fileLabelRect.GetTop() + nameHeight +
+                        wxRound(GetLabelPaddingHeight() * 0.5) };
+                    if (IsFileListFiltered() && !nameMatched)
+                    {
+                        drawFilterMatch(PageFont::Normal, pathLabel, pathPos);
+                    }
+                    dc.DrawText(pathLabel, pathPos);
                 }
-                else
+                // draw the modified time off to the side
+                if ((fileIcon.GetLogicalWidth() +
+                    GetLabelPaddingWidth() +
+                    m_filePathLabelWidth + m_timeLabelWidth) <
+                    fileLabelRect.GetWidth())
                 {
-                    dateStr = wxString::Format(// TRANSLATORS: DAY at TIME OF DAY
-                        _(L"%s at %s"),
-                        wxDateTime::GetWeekDayName(dt.GetWeekDay(),
-                            wxDateTime::NameFlags::Name_Abbr),
-                        timeStr);
+                    // (already formatted when the labels were measured)
+                    const wxString& modTimeStr = fileButton.m_timeLabel;
+                    if (!modTimeStr.empty())
+                    {
+                        const wxSize timeStringSize =
+                            MeasureText(dc, PageFont::Normal, modTimeStr);
+                        dc.DrawText(modTimeStr,
+                            fileLabelRect.GetRight() -
+                            (m_timeLabelWidth + GetLabelPaddingHeight()),
+                            fileLabelRect.GetTop() +
+                            (wxRound(fileLabelRect.GetHeight() * 0.5) -
+                                wxRound(timeStringSize.GetHeight() * 0.5)));
+                    }
                 }
             }
+            // if not using an icon, then just keep it
+            // simple and draw the filename
             else
             {
-                // only show year if modified last year
-                const wxString dateFormatStr =
-                    (wxDateTime::Now().GetYear() == dt.GetYear()) ?
-                    L"%B %d " :
-                    L"%B %d, %Y";
-                dateStr = dt.Format(dateFormatStr);
-            }
-
-            return dateStr;
-        };
-
-    // file labels
-    {
-        // Get the widest file modified time label so that we can draw 
-        // them ragged right. Also, get the longest file path to make
-        // sure the time and path don't overlap.
-        decltype(wxSize::x) filePathLabelWidth{ 0 };
-        decltype(wxSize::x) timeLabelWidth{ 0 };
-        {
-            const wxDCFontChanger fc(dc, wxFont(dc.GetFont()));
-            for (size_t i = 0; i < GetMRUFileCount(); ++i)
-            {
-                if (m_fileButtons[i].IsOk())
+                if (IsFileListFiltered())
                 {
-                    const wxFileName fn(m_fileButtons[i].m_fullFilePath);
-                    wxDateTime accessTime, modTime, createTime;
-                    if (fn.FileExists() && fn.GetTimes(&accessTime, &modTime, &createTime))
-                    {
-                        const wxString modTimeStr =
-                            formatFileDateTime(modTime);
-                        const wxSize timeStringSize =
-                            dc.GetTextExtent(modTimeStr);
-                        timeLabelWidth = std::max(timeLabelWidth, timeStringSize.GetWidth());
-                    }
-                    const wxSize filePathStringSize =
-                        dc.GetTextExtent(fn.GetPath());
-                    filePathLabelWidth = std::max(filePathLabelWidth, filePathStringSize.GetWidth());
+                    drawFilterMatch(PageFont::Normal, fn.GetFullName(),
+                        wxPoint{ fileLabelRect.GetLeft(),
+                                 fileLabelRect.GetTop() +
+                                 (fileLabelRect.GetHeight() -
+                                  MeasureText(dc, PageFont::Normal,
+                                              fn.GetFullName()).GetHeight()) / 2 });
                 }
+                DrawPageLabel(dc, PageFont::Normal, fn.GetFullName(), wxNullBitmap,
+                    fileLabelRect, wxALIGN_LEFT | wxALIGN_CENTRE_VERTICAL);
             }
+            // draw separator line, unless this button is highlighted
+            if (m_activeButton != GetFileRowId(i))
+            {
+                const wxDCPenChanger pc(dc, mruSeparatorLineColor);
+                dc.DrawLine(rowRect.GetLeftBottom(),
+                    rowRect.GetRightBottom());
+            }
+            dc.DestroyClippingRegion();
         }
 
-        // begin drawing them
-        wxBitmap fileIcon = m_logo.GetBitmap(ScaleToContentSize(wxSize{ 32, 32 }));
-        if (fileIcon.IsOk())
-        {
-            fileIcon.SetScaleFactor(GetContentScaleFactor());
-        }
-
-        // if empty state, draw the message
-        if (GetMRUFileCount() == 0 && GetMRUFileAndClearButtonCount() > 0 && IsBrowseId(m_fileButtons[0].m_id))
-        {
-            const wxDCTextColourChanger tcc(dc, mruFontColor);
-            const wxRect emptyStateMessageRect =
-                wxRect(filesArea.GetLeft() + GetLabelPaddingWidth(),
-                    m_fileColumnHeaderHeight + GetLabelPaddingHeight(),
-                    filesArea.GetWidth() - (2 * GetLabelPaddingWidth()),
-                    dc.GetTextExtent(GetNoRecentFilesLabel()).GetHeight());
-            dc.DrawLabel(GetNoRecentFilesLabel(), emptyStateMessageRect, wxALIGN_LEFT);
-        }
-
-        for (size_t i = 0; i < GetMRUFileAndClearButtonCount(); ++i)
+        // a thin scroll thumb along the side of the rows if they don't all fit
+        if (GetMaxFileScrollPosition() > 0)
         {
-            if (m_fileButtons[i].IsOk())
+            const double rowsHeight =
+                static_cast<double>(GetFileRowCount()) * GetMRUButtonHeight();
+            const wxCoord thumbHeight = std::max<wxCoord>(FromDIP(16),
+                wxRound(fileRowsRect.GetHeight() * (fileRowsRect.GetHeight() / rowsHeight)));
+            const wxCoord thumbTop = fileRowsRect.GetTop() +
+                wxRound((fileRowsRect.GetHeight() - thumbHeight) *
+                    (static_cast<double>(m_fileScrollPosition) / GetMaxFileScrollPosition()));
+            const wxRect thumbRect{ fileRowsRect.GetRight() - FromDIP(4), thumbTop,
+                                    FromDIP(4), thumbHeight };
+            if (isDamaged(thumbRect))
             {
-                const wxDCTextColourChanger tcc(dc,
-                    m_activeButton == m_fileButtons[i].m_id ?
-                    mruFontHoverColor : mruFontColor);
-                const wxRect fileLabelRect =
-                    wxRect{ m_fileButtons[i].m_rect }.Deflate(GetLabelPaddingHeight());
-                dc.SetClippingRegion(m_fileButtons[i].m_rect);
-                // if the "clear file list" button or "browse" button
-                if (i == GetMRUFileAndClearButtonCount() - 1 || IsBrowseId(m_fileButtons[i].m_id))
-                {
-                    const wxDCFontChanger fc(dc, wxFont(dc.GetFont()).MakeLarger());
-                    wxBitmap bmp = m_fileButtons[i].m_icon.GetBitmap(ScaleToContentSize(buttonIconSize));
-                    if (bmp.IsOk())
-                    {
-                        bmp.SetScaleFactor(GetContentScaleFactor());
-                        dc.DrawLabel(m_fileButtons[i].m_label, bmp, fileLabelRect,
-                                     wxALIGN_LEFT | wxALIGN_CENTRE_VERTICAL);
-                    }
-                    else
-                    {
-                        dc.DrawLabel(m_fileButtons[i].m_label, fileLabelRect,
-                            wxALIGN_LEFT | wxALIGN_CENTRE_VERTICAL);
-                    }
-                }
-                else
-                {
-                    // show the files
-                    const wxFileName fn(m_fileButtons[i].m_fullFilePath);
-                    if (fileIcon.IsOk())
-                    {
-                        dc.DrawBitmap(fileIcon,
-                            wxPoint(fileLabelRect.GetLeft(),
-                                fileLabelRect.GetTop() +
-                                wxRound((fileLabelRect.GetHeight() - fileIcon.GetLogicalHeight()) * 0.5)
-                            ));
-                        int nameHeight{ 0 };
-                        // draw the filename
-                        {
-                            const wxDCFontChanger fc(dc, wxFont(dc.GetFont()).MakeLarger());
-                            nameHeight =
-                                dc.GetTextExtent(fn.GetFullName()).GetHeight();
-                            dc.DrawText(fn.GetFullName(),
-                                wxPoint(fileLabelRect.GetLeft() +
-                                    GetLabelPaddingWidth() + fileIcon.GetLogicalWidth(),
-                                    fileLabelRect.GetTop()));
-                        }
-                        // draw the filepath
-                        {
-                            const wxDCTextColourChanger cc(dc, mruFontColor);
-                            dc.DrawText(
-                                // truncate the path is necessary
-                                (m_fileButtons[i].m_label.length() <= 75) ?
-                                m_fileButtons[i].m_label :
-                                // TRANSLATORS: "..." implies a truncated file path.
-                                (m_fileButtons[i].m_label.substr(0, 75) + _(L"...")),
-                                wxPoint(fileLabelRect.GetLeft() +
-                                    GetLabelPaddingWidth() +
-                                    fileIcon.GetLogicalWidth(),
-                                    fileLabelRect.GetTop() + nameHeight +
-                                    wxRound(GetLabelPaddingHeight() * 0.5)));
-                        }
-                        // draw the modified time off to the side
-                        if ((fileIcon.GetLogicalWidth() +
-                            GetLabelPaddingWidth() +
-                            filePathLabelWidth + timeLabelWidth) <
-                            fileLabelRect.GetWidth())
-                        {
-                            wxDateTime accessTime, modTime, createTime;
-                            if (fn.FileExists() && fn.GetTimes(&accessTime, &modTime, &createTime))
-                            {
-                                const wxString modTimeStr =
-                                    formatFileDateTime(modTime);
-                                const wxSize timeStringSize =
-                                    dc.GetTextExtent(modTimeStr);
-                                dc.DrawText(modTimeStr,
-                                    fileLabelRect.GetRight() -
-                                    (timeLabelWidth + GetLabelPaddingHeight()),
-                                    fileLabelRect.GetTop() +
-                                    (wxRound(fileLabelRect.GetHeight() * 0.5) -
-                                        wxRound(timeStringSize.GetHeight() * 0.5)));
-                            }
-                        }
-                    }
-                    // if not using an icon, then just keep it
-                    // simple and draw the filename
-                    else
-                    {
-                        dc.DrawLabel(fn.GetFullName(), fileLabelRect,
-                            wxALIGN_LEFT | wxALIGN_CENTRE_VERTICAL);
-                    }
-                    // draw separator line, unless this button is highlighted
-                    if (m_activeButton != m_fileButtons[i].m_id)
-                    {
-                        const wxDCPenChanger pc(dc, mruSeparatorLineColor);
-                        dc.DrawLine(m_fileButtons[i].m_rect.GetLeftBottom(),
-                            m_fileButtons[i].m_rect.GetRightBottom());
-                    }
-                }
-                dc.DestroyClippingRegion();
+                const wxDCPenChanger pc(dc, *wxTRANSPARENT_PEN);
+                const wxDCBrushChanger bc(dc, ShadeOrTint(GetMRUBackgroundColor(), 0.4));
+                dc.DrawRoundedRectangle(thumbRect, FromDIP(2));
             }
         }
     }
 
     // draw the custom button labels
     {
-        m_buttonHeight = buttonIconSize.GetHeight() + (2 * GetLabelPaddingHeight());
-        const wxDCFontChanger fc(dc, m_buttons.size() > MAX_BUTTONS_SMALL_SIZE ?
-            dc.GetFont() :
-            dc.GetFont().Larger());
-        for (const auto& button : m_buttons)
+        const TraceSpan buttonsSpan{ "DrawCustomButtons" };
+        for (auto& button : m_buttons)
         {
-            if (button.IsOk())
+            if (button.IsOk() && isDamaged(button.m_rect))
             {
                 const wxDCTextColourChanger cc(dc,
                     m_activeButton == button.m_id ?
@@ -1043,17 +4644,18 @@ void wxStartPage::OnPaintWindow([[maybe_unused]] wxPaintEvent& event)
 
                 // draw it
                 dc.SetClippingRegion(button.m_rect);
-                wxBitmap bmp = button.m_icon.GetBitmap(ScaleToContentSize(buttonIconSize));
+                const wxBitmap& bmp =
+                    GetRenderedBitmap(button.m_icon, button.m_renderedIcon, buttonIconSize);
                 if (bmp.IsOk())
                 {
-                    bmp.SetScaleFactor(GetContentScaleFactor());
-                    dc.DrawLabel(button.m_label, bmp,
-                        wxRect{ button.m_rect }.Deflate(GetLabelPaddingWidth()));
+                    DrawPageLabel(dc, GetButtonFont(), button.m_label, bmp,
+                        wxRect{ button.m_rect }.Deflate(GetLabelPaddingWidth()),
+                        wxALIGN_LEFT | wxALIGN_TOP, true);
                 }
                 else
                 {
-                    dc.DrawLabel(button.m_label, button.m_rect,
-                        wxALIGN_LEFT | wxALIGN_CENTRE_VERTICAL);
+                    DrawPageLabel(dc, GetButtonFont(), button.m_label, wxNullBitmap,
+                        button.m_rect, wxALIGN_LEFT | wxALIGN_CENTRE_VERTICAL, true);
                 }
                 dc.DestroyClippingRegion();
             }
@@ -1064,53 +4666,43 @@ void wxStartPage::OnPaintWindow([[maybe_unused]] wxPaintEvent& event)
 //---------------------------------------------------
 void wxStartPage::OnMouseChange(wxMouseEvent& event)
 {
-    // see which (if any) button was previously highlighted
-    wxRect previousRect, currentRect;
-    if (m_activeButton != wxNOT_FOUND)
+    // Mice can report moves far more often than the screen refreshes, so only
+    // the latest position is kept and it is hit-tested once the events already
+    // queued are handled. The highlight is then invalidated (not forcibly painted),
+    // so that it is drawn with the next frame.
+    m_hoverPosition = event.GetPosition();
+    if (m_hoverUpdateQueued)
     {
-        for (const auto& button : m_buttons)
-        {
-            if (m_activeButton == button.m_id)
-            {
-                previousRect = button.m_rect;
-                break;
-            }
-        }
-        for (size_t i = 0; i < GetMRUFileAndClearButtonCount(); ++i)
+        if (m_statsEnabled)
         {
-            if (m_activeButton == m_fileButtons[i].m_id)
-            {
-                previousRect = m_fileButtons[i].m_rect;
-                break;
-            }
+            ++m_stats.m_coalescedMouseMoves;
         }
+        return;
     }
+    m_hoverUpdateQueued = true;
+    CallAfter([this, firstMove = m_statsEnabled ? std::chrono::steady_clock::now() :
+                                                  std::chrono::steady_clock::time_point{}]()
+        { UpdateHover(firstMove); });
+}
 
-    const auto previouslyActiveButton{ m_activeButton };
-    wxWindowID buttonUnderMouse{ wxNOT_FOUND };
-
-    for (const auto& button : m_buttons)
+//---------------------------------------------------
+void wxStartPage::UpdateHover(const std::chrono::steady_clock::time_point firstMove)
+{
+    const TraceSpan span{ "UpdateHover" };
+    m_hoverUpdateQueued = false;
+    // the mouse left the window since
+    if (m_hoverPosition == wxDefaultPosition)
     {
-        if (button.IsOk() &&
-            button.m_rect.Contains(event.GetX(), event.GetY()))
-        {
-            buttonUnderMouse = button.m_id;
-            break;
-        }
+        return;
     }
+    const wxPoint hoverPosition{ m_hoverPosition };
+    m_hoverPosition = wxDefaultPosition;
 
-    if (buttonUnderMouse == wxNOT_FOUND)
-    {
-        for (size_t i = 0; i < GetMRUFileAndClearButtonCount(); ++i)
-        {
-            if (m_fileButtons[i].IsOk() &&
-                m_fileButtons[i].m_rect.Contains(event.GetX(), event.GetY()))
-            {
-                buttonUnderMouse = m_fileButtons[i].m_id;
-                break;
-            }
-        }
-    }
+    // see which (if any) button was previously highlighted
+    const wxRect previousRect{ GetButtonRect(m_activeButton) };
+
+    const auto previouslyActiveButton{ m_activeButton };
+    const wxWindowID buttonUnderMouse{ HitTest(hoverPosition) };
 
     if (buttonUnderMouse != wxNOT_FOUND)
     {
@@ -1127,28 +4719,7 @@ void wxStartPage::OnMouseChange(wxMouseEvent& event)
     }
 
     // refresh the current and previous (if applicable) highlighted areas
-    if (m_activeButton != wxNOT_FOUND)
-    {
-        for (const auto& button : m_buttons)
-        {
-            if (m_activeButton == button.m_id)
-            {
-                currentRect = button.m_rect;
-                break;
-            }
-        }
-        if (currentRect.IsEmpty())
-        {
-            for (size_t i = 0; i < GetMRUFileAndClearButtonCount(); ++i)
-            {
-                if (m_activeButton == m_fileButtons[i].m_id)
-                {
-                    currentRect = m_fileButtons[i].m_rect;
-                    break;
-                }
-            }
-        }
-    }
+    const wxRect currentRect{ GetButtonRect(m_activeButton) };
 
     wxRect refreshRect = previousRect.IsEmpty() ?
         currentRect :
@@ -1156,71 +4727,60 @@ void wxStartPage::OnMouseChange(wxMouseEvent& event)
     if (!refreshRect.IsEmpty())
     {
         refreshRect.Inflate(GetLabelPaddingHeight());
-        Refresh(true, &refreshRect);
-        Update();
+        RefreshHover(refreshRect);
+        if (m_hoverStart == std::chrono::steady_clock::time_point{})
+        {
+            m_hoverStart = firstMove;
+        }
     }
 }
 
 //---------------------------------------------------
 void wxStartPage::OnMouseLeave([[maybe_unused]] wxMouseEvent& event)
 {
-    if (HasFocus())
+    // drop a move that hasn't been hit-tested yet
+    m_hoverPosition = wxDefaultPosition;
+    if (HasFocus() || m_activeButton == wxNOT_FOUND)
     {
         return;
     }
 
-    // see which (if any) button was previously highlighted
-    wxRect refreshRect;
-    if (m_activeButton != wxNOT_FOUND)
-    {
-        for (const auto& button : m_buttons)
-        {
-            if (m_activeButton == button.m_id)
-            {
-                refreshRect = button.m_rect;
-                break;
-            }
-        }
-        for (size_t i = 0; i < GetMRUFileAndClearButtonCount(); ++i)
-        {
-            if (m_activeButton == m_fileButtons[i].m_id)
-            {
-                refreshRect = m_fileButtons[i].m_rect;
-                break;
-            }
-        }
-    }
-    else
-    {
-        return;
-    }
+    // the previously highlighted button
+    wxRect refreshRect{ GetButtonRect(m_activeButton) };
 
     m_activeButton = wxNOT_FOUND;
 
     refreshRect.Inflate(GetLabelPaddingHeight());
-    Refresh(true, &refreshRect);
-    Update();
+    RefreshHover(refreshRect);
 }
 
 //---------------------------------------------------
-void wxStartPage::OnMouseClick(wxMouseEvent& event)
+void wxStartPage::OnMouseWheel(wxMouseEvent& event)
 {
-    for (const auto& button : m_buttons)
+    if (GetMaxFileScrollPosition() <= 0 || event.GetWheelDelta() <= 0 ||
+        event.GetWheelAxis() != wxMOUSE_WHEEL_VERTICAL)
     {
-        if (button.IsOk() &&
-            button.m_rect.Contains(event.GetX(), event.GetY()))
-        {
-            ActivateButton(button.m_id);
-            return;
-        }
+        event.Skip();
+        return;
     }
-    for (size_t i = 0; i < GetMRUFileAndClearButtonCount(); ++i)
+
+    // scroll by pixels (rather than whole rows), so that
+    // high-resolution wheels and touchpads scroll smoothly
+    const wxCoord scrollDistance = wxRound(
+        (static_cast<double>(event.GetWheelRotation()) / event.GetWheelDelta()) *
+        event.GetLinesPerAction() * GetCharHeight());
+    ScrollFileRows(m_fileScrollPosition - scrollDistance);
+
+    // a different row is now under the mouse
+    OnMouseChange(event);
+}
+
+//---------------------------------------------------
+void wxStartPage::OnMouseClick(wxMouseEvent& event)
+{
+    const wxWindowID buttonUnderMouse{ HitTest(event.GetPosition()) };
+    if (buttonUnderMouse != wxNOT_FOUND)
     {
-        if (m_fileButtons[i].IsOk() &&
-            m_fileButtons[i].m_rect.Contains(event.GetX(), event.GetY()))
-        {
-            ActivateButton(m_fileButtons[i].m_id);
-            return;
-        }
+        ActivateButton(buttonUnderMouse);
     }
 }
@@ -12,15 +12,28 @@
 #define WXSTART_PAGE_H
 
 #include <algorithm>
+#include <array>
 #include <cassert>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 #include <wx/artprov.h>
 #include <wx/dcgraph.h>
 #include <wx/filename.h>
+#include <wx/timer.h>
 #include <wx/window.h>
 #include <wx/wx.h>
 
+class wxFileSystemWatcher;
+class wxFileSystemWatcherEvent;
+class wxSearchCtrl;
+
 wxDECLARE_EVENT(wxEVT_STARTPAGE_CLICKED, wxCommandEvent);
 
 #define EVT_STARTPAGE_CLICKED(winid, fn) \
@@ -49,10 +62,156 @@ enum class wxStartPageAppHeaderStyle
     wxStartPageNoHeader        /*!<No application header.*/
 };
 
+/// @brief How to handle files in the MRU list that are on a network
+///     (or FUSE) file system.
+enum class wxStartPageRemoteFilePolicy
+{
+    wxProbeRemoteFiles,           /*!<Check remote files the same as local ones.
+                                      (This is the default.)*/
+    wxProbeRemoteFilesLazily,     /*!<Show remote files right away and check them in
+                                      the background, updating (or hiding) them afterwards.*/
+    wxShowUnavailableRemoteFiles, /*!<Show remote files that can't be reached as
+                                      "unavailable," rather than hiding them.*/
+    wxSkipRemoteFiles             /*!<Don't show remote files.*/
+};
+
+/// @brief The order that the files in the MRU list are shown in.
+enum class wxStartPageFileOrder
+{
+    wxSortFilesByModifiedTime, /*!<The first page of files (the ones checked, or read from the
+                                   metadata cache, before the list is shown) are sorted by
+                                   when they were modified, newest first. The rest follow in
+                                   the client's order. (This is the default.)*/
+    wxClientFileOrder          /*!<Show the files in the client's order.*/
+};
+
+/// @brief How the start page is drawn.
+enum class wxStartPageRenderer
+{
+    wxStartPageDefaultRenderer, /*!<Chosen at compile time from the toolkit: the DC on
+                                    GTK 3 and macOS, a @c wxGCDC elsewhere.
+                                    (This is the default.)*/
+    wxStartPageDCRenderer,      /*!<Draw directly with the window's DC. (On platforms where
+                                    this can't blend colors, translucent colors are blended
+                                    with what they are drawn over beforehand.)*/
+    wxStartPageGCDCRenderer     /*!<Draw through a @c wxGCDC (antialiased, with alpha blending).*/
+};
+
+/// @brief Counters for the start page's hot paths.
+/// @sa wxStartPage::EnableStats().
+struct wxStartPageStats
+{
+    /// @brief How many times an operation ran and how long it took.
+    struct Timing
+    {
+        unsigned long long m_count{ 0 };
+        std::chrono::nanoseconds m_total{ 0 };
+        std::chrono::nanoseconds m_max{ 0 };
+
+        /// @private
+        void Add(const std::chrono::nanoseconds duration) noexcept
+        {
+            ++m_count;
+            m_total += duration;
+            m_max = std::max(m_max, duration);
+        }
+    };
+
+    /// @brief How often a cache had what was asked for.
+    struct CacheCounter
+    {
+        unsigned long long m_hits{ 0 };
+        unsigned long long m_misses{ 0 };
+
+        /// @returns The share of lookups that were hits (0-1).
+        [[nodiscard]]
+        double GetHitRate() const noexcept
+        {
+            return (m_hits + m_misses == 0) ? 0.0 :
+                static_cast<double>(m_hits) / static_cast<double>(m_hits + m_misses);
+        }
+    };
+
+    /// @brief The upper bounds of the file probe latency buckets
+    ///     (the last bucket is for anything slower).
+    constexpr static std::array<std::chrono::milliseconds, 6> PROBE_LATENCY_LIMITS{
+        std::chrono::milliseconds{ 1 }, std::chrono::milliseconds{ 4 },
+        std::chrono::milliseconds{ 16 }, std::chrono::milliseconds{ 64 },
+        std::chrono::milliseconds{ 256 }, std::chrono::milliseconds{ 1024 }
+    };
+
+    /// @brief File system checks that were started.
+    unsigned long long m_fileProbes{ 0 };
+    /// @brief File system checks that were given up on.
+    unsigned long long m_fileProbeTimeouts{ 0 };
+    /// @brief How long the finished file system checks took,
+    ///     bucketed by @c PROBE_LATENCY_LIMITS.
+    std::array<unsigned long long, PROBE_LATENCY_LIMITS.size() + 1> m_fileProbeLatencies{};
+
+    Timing m_setMRUList;
+    /// @brief Recalculating the layout (when something it depends on changed).
+    Timing m_layout;
+    /// @brief Handling the window being resized.
+    Timing m_resize;
+    /// @brief Drawing the page, in total.
+    Timing m_paint;
+    /// @brief Redrawing the static parts of the page into the backdrop.
+    Timing m_paintBackdrop;
+    /// @brief Copying the backdrop to the window.
+    Timing m_paintBlit;
+    /// @brief Drawing the rows, buttons, and highlight over the backdrop.
+    Timing m_paintOverlay;
+
+    /// @brief Paints from the mouse moving to another button or row.
+    unsigned long long m_hoverPaints{ 0 };
+    /// @brief Paints from the page's content (or appearance) changing.
+    unsigned long long m_contentPaints{ 0 };
+    /// @brief Paints requested by the system (e.g., the window being uncovered).
+    unsigned long long m_systemPaints{ 0 };
+    /// @brief Mouse moves that were folded into a later one
+    ///     (rather than each being hit-tested).
+    unsigned long long m_coalescedMouseMoves{ 0 };
+    /// @brief From the mouse moving to another button or row until the
+    ///     highlight was painted.
+    Timing m_hoverLatency;
+    /// @brief When the stats were enabled (or reset).
+    std::chrono::steady_clock::time_point m_startTime{ std::chrono::steady_clock::now() };
+
+    CacheCounter m_textExtentCache;
+    CacheCounter m_timeLabelCache;
+    CacheCounter m_bitmapCache;
+    CacheCounter m_backdropCache;
+
+    /// @returns How many times per second the page has been painted
+    ///     (since the stats were enabled or reset).
+    [[nodiscard]]
+    double GetPaintsPerSecond() const
+    {
+        const double seconds{ std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - m_startTime).count() };
+        return (seconds > 0) ?
+            static_cast<double>(m_hoverPaints + m_contentPaints + m_systemPaints) / seconds :
+            0.0;
+    }
+
+    /// @private
+    void AddProbeLatency(const std::chrono::nanoseconds latency) noexcept
+    {
+        size_t bucket{ 0 };
+        while (bucket < PROBE_LATENCY_LIMITS.size() && latency >= PROBE_LATENCY_LIMITS[bucket])
+        {
+            ++bucket;
+        }
+        ++m_fileProbeLatencies[bucket];
+    }
+};
+
 /** @brief A wxWidgets landing page for an application.
 
-    It displays an MRU list on the right side (up to 9 files) and a list of
-    customizable buttons on the left.
+    It displays an MRU list on the right side and a list of
+    customizable buttons on the left. The MRU list scrolls, so it can hold
+    as many files as the application's history does; only the files that are
+    scrolled into view are checked on disk.
 
     Modified dates are shown next to each file in the MRU list. These dates
     are shown in a human-readable format
@@ -103,6 +262,8 @@ public:
     wxStartPage(const wxStartPage&) = delete;
     /// @private
     wxStartPage& operator=(const wxStartPage&) = delete;
+    /// @private
+    ~wxStartPage() override;
 
     /// @brief Sets the list of files to be shown in the
     ///     "most-recently-used" list on the right side.
@@ -111,9 +272,297 @@ public:
     ///     although they will remain in the parent application's MRU list.\n
     ///     That way, if a user is disconnected from their network,
     ///     then any network files won't appear, but may appear next time
-    ///     if they are then connected to the network.
+    ///     if they are then connected to the network.\n
+    ///     Files are shown in the order of the list, other than the first page
+    ///     (see SetFileOrder()). Only the files that fit
+    ///     on the page are checked up front; the rest are checked (in the background)
+    ///     as they are scrolled into view.\n
+    ///     Setting the same list that is already loaded does nothing.
+    /// @sa EnableAsyncFileProbing(), AddMRUFile().
     void SetMRUList(const wxArrayString& mruFiles);
 
+    /// @brief Adds a file to the top of the "most-recently-used" list.
+    /// @details Unlike SetMRUList(), only this file is checked (in the background)
+    ///     and only the rows that move are redrawn. The other files keep what is
+    ///     already known about them.\n
+    ///     If the file is already in the list, then it is promoted instead.
+    /// @param filePath The file to add.
+    void AddMRUFile(const wxString& filePath);
+    /// @brief Removes a file from the "most-recently-used" list.
+    /// @param filePath The file to remove.
+    void RemoveMRUFile(const wxString& filePath);
+    /// @brief Moves a file to the top of the "most-recently-used" list.
+    /// @param filePath The file to promote. This does nothing if it isn't in the list.
+    void PromoteMRUFile(const wxString& filePath);
+    /// @returns The number of files shown in the MRU list (whether they match the
+    ///     filter or not), which leaves out files that were found to be missing.
+    /// @note This doesn't include the "clear file list" or "browse" button.
+    [[nodiscard]]
+    size_t GetMRUFileCount() const noexcept
+    {
+        return m_fileButtons.size();
+    }
+
+    /// @brief Sets whether the files in the MRU list are checked on background threads.
+    /// @details When enabled, SetMRUList() returns immediately and each file's
+    ///     existence and modification time are checked on a pool of worker threads.
+    ///     The files are shown right away and are updated (or removed, if missing)
+    ///     as they are checked.\n
+    ///     This is recommended if the MRU list may contain files on network
+    ///     drives that could be slow or unresponsive.
+    /// @param enable @c true to check files in the background.
+    /// @note This affects subsequent calls to SetMRUList(). The list passed to
+    ///     the constructor is always loaded synchronously.
+    void EnableAsyncFileProbing(const bool enable = true) noexcept
+    {
+        m_asyncFileProbing = enable;
+    }
+    /// @returns @c true if files in the MRU list are checked on background threads.
+    [[nodiscard]]
+    bool IsAsyncFileProbing() const noexcept
+    {
+        return m_asyncFileProbing;
+    }
+
+    /// @brief Sets how long to wait for a file in the MRU list to respond.
+    /// @details Files are checked on worker threads, and a file that doesn't respond
+    ///     in time (e.g., on a disconnected network drive) is treated as unreachable.
+    ///     A file that times out (and the rest of its folder) isn't checked again
+    ///     until a backoff period (which doubles after each timeout) has passed.\n
+    ///     The files checked before the list is shown share one deadline, so a hung
+    ///     mount delays SetMRUList() by this long at most; files not checked by then
+    ///     are checked in the background.
+    /// @param timeout How long to wait on each file. The default is two seconds.\n
+    ///     Zero will check the files shown when the list is loaded on the calling
+    ///     thread, with no deadline.
+    void SetFileProbeTimeout(const std::chrono::milliseconds timeout) noexcept
+    {
+        m_probeTimeout = timeout;
+    }
+    /// @returns How long to wait for a file in the MRU list to respond.
+    [[nodiscard]]
+    std::chrono::milliseconds GetFileProbeTimeout() const noexcept
+    {
+        return m_probeTimeout;
+    }
+    /// @brief Sets how to handle files on network (or FUSE) file systems.
+    /// @param policy The policy for remote files.
+    /// @note Remote files are detected with @c statfs() (@c GetDriveType() on Windows),
+    ///     which is only called if the policy is not @c wxProbeRemoteFiles.
+    void SetRemoteFilePolicy(const wxStartPageRemoteFilePolicy policy) noexcept
+    {
+        m_remoteFilePolicy = policy;
+    }
+    /// @returns How files on network (or FUSE) file systems are handled.
+    [[nodiscard]]
+    wxStartPageRemoteFilePolicy GetRemoteFilePolicy() const noexcept
+    {
+        return m_remoteFilePolicy;
+    }
+    /// @brief Sets the order that the files in the MRU list are shown in.
+    /// @details By default, the files on the first page are sorted by when they
+    ///     were modified (newest first), but only those whose metadata is known
+    ///     when the list is set are (i.e., none are if the files are checked on
+    ///     background threads and there is no metadata cache). Files aren't moved
+    ///     after the list is shown, other than ones added or promoted to the top.
+    /// @param order The order to show the files in.
+    void SetFileOrder(const wxStartPageFileOrder order);
+    /// @returns The order that the files in the MRU list are shown in.
+    [[nodiscard]]
+    wxStartPageFileOrder GetFileOrder() const noexcept
+    {
+        return m_fileOrder;
+    }
+
+    /// @brief Sets whether the folders of the files in the MRU list are
+    ///     monitored for changes.
+    /// @details When enabled, files in the list that are modified, deleted,
+    ///     or recreated are updated in place (i.e., their modification times
+    ///     and visibility), without the client having to call SetMRUList().
+    /// @param enable @c true to watch the files' folders.
+    /// @note The watcher is created once the application's event loop is running.\n
+    ///     This requires wxWidgets to be built with @c wxUSE_FSWATCHER;
+    ///     otherwise, this does nothing.
+    void EnableFileWatching(const bool enable = true);
+    /// @returns @c true if the MRU list is being updated from file system changes.
+    [[nodiscard]]
+    bool IsFileWatching() const noexcept
+    {
+        return m_fileWatching;
+    }
+
+    /// @brief Sets the clock used to show how long ago the files were modified
+    ///     (e.g., "12 minutes ago").
+    /// @details This is meant for tests and benchmarks, so that the labels
+    ///     (and when they are refreshed) are deterministic.
+    /// @param clock A function returning the current time,
+    ///     or an empty function to use the system clock.
+    void SetClock(std::function<wxDateTime()> clock);
+    /// @brief Sets a function to look up the MRU files' metadata with,
+    ///     instead of checking the file system.
+    /// @details Like SetClock(), this is meant for tests and benchmarks, so that
+    ///     which files are shown (and their modified times) are deterministic.
+    ///     The function is called on the UI thread, and the whole list is
+    ///     checked with it up front (the metadata cache isn't used).
+    /// @param fileInfoSource A function taking a file path and returning when the
+    ///     file was modified (or an invalid date if the file doesn't exist),
+    ///     or an empty function to check the file system.
+    void SetFileInfoSource(std::function<wxDateTime(const wxString&)> fileInfoSource);
+
+    /// @brief Starts (or stops) counting how often the hot paths run and how
+    ///     long they take (e.g., file checks, layout, and painting).
+    /// @details This costs next to nothing when disabled (the default).
+    ///     It is enabled automatically if the @c STATS_TRACE_MASK trace mask
+    ///     is (e.g., via the @c WXTRACE environment variable), in which case
+    ///     the stats are also logged when the start page is destroyed.
+    /// @param enable @c true to count the stats.
+    /// @sa GetStats(), LogStats().
+    void EnableStats(const bool enable = true) noexcept
+    {
+        m_statsEnabled = enable;
+    }
+    /// @returns @c true if the hot paths' stats are being counted.
+    [[nodiscard]]
+    bool IsStatsEnabled() const noexcept
+    {
+        return m_statsEnabled;
+    }
+    /// @returns The hot paths' stats (since they were enabled or last reset).
+    [[nodiscard]]
+    const wxStartPageStats& GetStats() const noexcept
+    {
+        return m_stats;
+    }
+    /// @brief Sets the stats back to zero.
+    void ResetStats() noexcept
+    {
+        m_stats = wxStartPageStats{};
+    }
+    /// @brief Logs the stats with @c wxLogTrace(), under @c STATS_TRACE_MASK.
+    void LogStats() const;
+    /// @brief The trace mask that the stats are logged under.
+    constexpr static const wchar_t* STATS_TRACE_MASK{ L"wxStartPage" };
+
+    /// @brief Starts (or stops) recording a timeline of what start pages are doing,
+    ///     which can be written with WriteTrace().
+    /// @details This records spans for loading the MRU list (reading the cache,
+    ///     checking the files, building the rows and the search index),
+    ///     resizing, each phase of painting, and clicks (including the client's
+    ///     handling of them), as well as file checks on the worker threads.\n
+    ///     Each thread records into its own fixed-size ring buffer without locking,
+    ///     so this is cheap enough to leave enabled in a release build
+    ///     (only the most recent spans are kept).
+    ///     When disabled (the default), each span only checks a flag.
+    /// @param enable @c true to record spans.
+    /// @note This applies to all start pages in the application.
+    static void EnableTracing(const bool enable = true) noexcept;
+    /// @returns @c true if spans are being recorded.
+    [[nodiscard]]
+    static bool IsTracingEnabled() noexcept;
+    /// @brief Writes the recorded spans to a file as Chrome trace-event JSON,
+    ///     which can be opened in Perfetto (ui.perfetto.dev) or @c chrome://tracing.
+    /// @param filePath The file to write to (e.g., "startpage.json").
+    /// @returns @c true if the file was written.
+    static bool WriteTrace(const wxString& filePath);
+
+    /// @private
+    void Refresh(bool eraseBackground = true, const wxRect* rect = nullptr) override
+    {
+        m_pendingPaints |= PAINT_CONTENT;
+        wxWindow::Refresh(eraseBackground, rect);
+    }
+
+    /// @brief Draws the start page into a bitmap, without it needing to be shown.
+    /// @details This lays out and draws the page the same way as when it is
+    ///     painted, but for the given size (and scale), which makes it useful for
+    ///     thumbnails, golden images, and benchmarking.\n
+    ///     Call SetClock() and SetFileInfoSource() beforehand to make the output
+    ///     deterministic.
+    /// @param size The (logical) size to draw the page at.
+    /// @param scaleFactor The content scale factor to draw at (e.g., 2 for a Retina display).
+    /// @returns The page, or an invalid bitmap if the size or scale factor is invalid.
+    [[nodiscard]]
+    wxBitmap RenderToBitmap(const wxSize& size, const double scaleFactor = 1.0);
+    /// @brief Draws the start page into an image, without it needing to be shown.
+    /// @param size The (logical) size to draw the page at.
+    /// @param scaleFactor The content scale factor to draw at.
+    /// @returns The page, or an invalid image if the size or scale factor is invalid.
+    /// @sa RenderToBitmap().
+    [[nodiscard]]
+    wxImage RenderToImage(const wxSize& size, const double scaleFactor = 1.0)
+    {
+        const wxBitmap page{ RenderToBitmap(size, scaleFactor) };
+        return page.IsOk() ? page.ConvertToImage() : wxImage{};
+    }
+
+    /// @brief Looks up the standard user folders (e.g., "Documents" or "Downloads") again.
+    /// @details These folders are looked up once and used to shorten the paths shown
+    ///     under the files; call this if the user may have moved them
+    ///     (e.g., after an XDG @c user-dirs.dirs change).
+    void RefreshUserFolders();
+
+    /// @brief Sets a file to keep the MRU files' metadata in between sessions.
+    /// @details When set, SetMRUList() shows the files using what was cached
+    ///     (without touching the disk), and then re-checks them in the background
+    ///     as they are scrolled into view. Files that aren't in the cache are
+    ///     checked the usual way.\n
+    ///     The cache is a compact binary file that is memory mapped when it is read.
+    ///     It is saved when the start page is destroyed (or by SaveFileInfoCache()).
+    /// @param cachePath The cache file (e.g., in the application's user data folder).
+    ///     An empty path turns off caching.
+    /// @note Set this before calling SetMRUList(). (The list passed to the
+    ///     constructor is loaded before a cache can be set.)
+    void SetFileInfoCachePath(wxString cachePath)
+    {
+        m_fileInfoCachePath = std::move(cachePath);
+    }
+    /// @returns The file that the MRU files' metadata is cached in.
+    [[nodiscard]]
+    const wxString& GetFileInfoCachePath() const noexcept
+    {
+        return m_fileInfoCachePath;
+    }
+    /// @brief Writes what is known about the MRU files to the cache file.
+    /// @returns @c true if the cache was saved.
+    /// @sa SetFileInfoCachePath().
+    bool SaveFileInfoCache() const;
+    /// @returns @c true if a cache file was written (by this version of the start page)
+    ///     for the same list of files.
+    /// @details This only reads the cache's header, so it is a cheap way to tell if
+    ///     the application's file history changed since the cache was saved.\n
+    ///     Note that a stale cache is still used for the files that are in it.
+    /// @param cachePath The cache file.
+    /// @param mruFiles The list of files to compare against.
+    [[nodiscard]]
+    static bool IsFileInfoCacheCurrent(const wxString& cachePath, const wxArrayString& mruFiles);
+
+    /// @brief Sets whether a search box is shown above the MRU list,
+    ///     which filters the list as the user types.
+    /// @details The files' paths are indexed when the list is set, so each keystroke
+    ///     only checks the files that could match (and, as the search text grows,
+    ///     only the files that matched before).\n
+    ///     Pressing @c Enter in the search box opens the first matching file.
+    /// @param enable @c true to show the search box.
+    void EnableFileFilter(const bool enable = true);
+    /// @returns @c true if a search box is shown above the MRU list.
+    [[nodiscard]]
+    bool IsFileFilterEnabled() const noexcept
+    {
+        return m_fileFilterEnabled;
+    }
+    /// @brief Only shows the files in the MRU list whose paths contain the given text
+    ///     (case insensitively).
+    /// @details This is what the search box calls as the user types, but it can also
+    ///     be called directly (the search box is updated to match).
+    /// @param filter The text to search for. An empty string shows all the files.
+    void SetFileFilter(const wxString& filter);
+    /// @returns The text that the MRU list is filtered by.
+    [[nodiscard]]
+    const wxString& GetFileFilter() const noexcept
+    {
+        return m_fileFilter;
+    }
+
     /// @name Button Functions
     /// @brief Functions for adding buttons and handling their events.
     /// @{
@@ -122,7 +571,8 @@ public:
     /// @details A feature button can be something like
     ///     "Read the Help" or "Create a New Project."
     /// @param bmp The image for the button.
-    /// @param label The label on the button.
+    /// @param label The label on the button. As with @c wxDC::DrawLabel(), an "&"
+    ///     underlines the character after it, and "&&" shows an "&".
     /// @returns The ID assigned to the button. This should be used in your
     ///     @c wxEVT_STARTPAGE_CLICKED handler.
     /// @sa GetButtonID().
@@ -130,32 +580,23 @@ public:
     {
         m_buttons.emplace_back(bmp, label);
         m_buttons.back().m_id = ID_BUTTON_ID_START + (m_buttons.size() - 1);
+        InvalidateLayout(LAYOUT_BUTTON_AREA);
         return m_buttons.back().m_id;
     }
     /// @brief Adds a feature button on the left side.
     /// @details A feature button can be something like
     ///     "Read the Help" or "Create a New Project."
     /// @param artId The stock art ID to use for the button's icon.
-    /// @param label The label on the button.
+    /// @param label The label on the button. As with @c wxDC::DrawLabel(), an "&"
+    ///     underlines the character after it, and "&&" shows an "&".
     /// @returns The ID assigned to the button. This should be used in your
     ///     @c wxEVT_STARTPAGE_CLICKED handler.
     /// @sa GetButtonID().
+    /// @note The icon is only rasterized once it is drawn, at the size (and scale)
+    ///     that it is drawn at.
     wxWindowID AddButton(const wxArtID& artId, const wxString& label)
     {
-        const wxVector<wxBitmap> bmps = {
-            wxArtProvider::GetBitmap(artId, wxART_BUTTON,
-                                     ScaleToContentSize(FromDIP(wxSize{ 16, 16 }))),
-            wxArtProvider::GetBitmap(artId, wxART_BUTTON,
-                                     ScaleToContentSize(FromDIP(wxSize{ 32, 32 }))),
-            wxArtProvider::GetBitmap(artId, wxART_BUTTON,
-                                     ScaleToContentSize(FromDIP(wxSize{ 64, 64 }))),
-            wxArtProvider::GetBitmap(artId, wxART_BUTTON,
-                                     ScaleToContentSize(FromDIP(wxSize{ 128, 128 })))
-        };
-
-        m_buttons.emplace_back(wxBitmapBundle::FromBitmaps(bmps), label);
-        m_buttons.back().m_id = ID_BUTTON_ID_START + (m_buttons.size() - 1);
-        return m_buttons.back().m_id;
+        return AddButton(CreateArtBundle(artId), label);
     }
     /// @returns The ID of the given index into the custom button list,
     ///     or @c wxNOT_FOUND if an invalid index is given.
@@ -179,10 +620,12 @@ public:
     /// @returns @c true if @c id is an ID within the MRU list.
     /// @param id The ID from a @c wxEVT_STARTPAGE_CLICKED event after a
     ///     user clicks a button on the start page.
+    /// @note File IDs aren't a fixed range (there is one for each row of the list,
+    ///     however long it is), so use this rather than comparing against specific IDs.
     [[nodiscard]]
     constexpr static bool IsFileId(const wxWindowID id) noexcept
     {
-        return (id >= ID_FILE_ID_START && id < START_PAGE_FILE_LIST_CLEAR);
+        return (id >= ID_FILE_ID_START);
     }
     /// @returns @c true if @c id is the "Clear file list" button.
     /// @param id The ID from a @c wxEVT_STARTPAGE_CLICKED event after a
@@ -212,12 +655,28 @@ public:
     {
         m_style = style;
     }
+    /// @brief Sets how the start page is drawn.
+    /// @param renderer How to draw the start page.
+    /// @details By default, the page is drawn directly with the window's DC where that
+    ///     already antialiases and blends colors (GTK 3 and macOS), since wrapping it in a
+    ///     @c wxGCDC only adds overhead there. Elsewhere, a @c wxGCDC is used.
+    ///     This is chosen at compile time (not measured); the benchmark's per-backend
+    ///     cases show which is faster on a given machine.
+    void SetRenderer(const wxStartPageRenderer renderer);
+    /// @returns How the start page is drawn.
+    [[nodiscard]]
+    wxStartPageRenderer GetRenderer() const noexcept
+    {
+        return m_renderer;
+    }
     /// @brief Sets which type of greeting (if any) to display.
     /// @param style The greeting style for the start page.
     /// @sa SetCustomGreeting().
     void SetGreetingStyle(const wxStartPageGreetingStyle style) noexcept
     {
         m_greetingStyle = style;
+        InvalidateGreeting();
+        InvalidateLayout(LAYOUT_FILE_AREA);
     }
     /// @brief Sets a custom greeting to display.
     /// @param greeting The custom greeting to use.
@@ -225,12 +684,15 @@ public:
     {
         m_customGreeting = std::move(greeting);
         m_greetingStyle = wxStartPageGreetingStyle::wxCustomGreeting;
+        InvalidateGreeting();
+        InvalidateLayout(LAYOUT_FILE_AREA);
     }
     /// @brief Sets the name to display when style is set to @c wxDynamicGreetingWithUserName.
     /// @param name The username to use.
     void SetUserName(wxString name)
     {
         m_userName = std::move(name);
+        InvalidateGreeting();
     }
     /** @brief How to display the application name and icon
             above the custom buttons.
@@ -238,6 +700,7 @@ public:
     void SetAppHeaderStyle(const wxStartPageAppHeaderStyle style) noexcept
     {
         m_appHeaderStyle = style;
+        InvalidateLayout(LAYOUT_BUTTON_AREA);
     }
     /// @returns The color of the left side of the start page.
     [[nodiscard]]
@@ -252,6 +715,7 @@ public:
         if (color.IsOk())
         {
             m_buttonAreaBackgroundColor = color;
+            m_backdropDirty = true;
         }
     }
     /// @returns The color of the right side of the start page.
@@ -267,10 +731,45 @@ public:
         if (color.IsOk())
         {
             m_MRUBackgroundColor = color;
+            m_backdropDirty = true;
         }
     }
     /// @}
+
+    /// @private
+    bool SetFont(const wxFont& font) override;
 private:
+    /// @brief A snapshot of a file's metadata, read with a single @c stat() call.
+    struct FileInfo
+    {
+        bool m_exists{ false };
+        wxDateTime m_modTime;
+        wxULongLong m_size{ 0 };
+        // on a network (or FUSE) file system
+        bool m_remote{ false };
+        // couldn't be reached (shown, but marked as unavailable)
+        bool m_unavailable{ false };
+        // shown before being checked (e.g., scrolled out of view,
+        // or a remote file with wxProbeRemoteFilesLazily)
+        bool m_pendingProbe{ false };
+
+        /// @returns @c true if the file should be shown in the MRU list.
+        [[nodiscard]]
+        bool IsShown() const noexcept
+        {
+            return m_exists || m_unavailable || m_pendingProbe;
+        }
+    };
+
+    // An image from a bitmap bundle, rasterized at the (logical) size and
+    // content scale factor that it was last drawn at.
+    struct RenderedBitmap
+    {
+        wxBitmap m_bitmap;
+        wxSize m_size{ wxDefaultSize };
+        double m_scaleFactor{ 0 };
+    };
+
     struct wxStartPageButton
     {
         wxStartPageButton(const wxBitmapBundle& icon, wxString label) :
@@ -285,11 +784,42 @@ private:
         }
         wxRect m_rect;
         wxBitmapBundle m_icon;
+        // the icon as it is drawn (replacing the button drops it)
+        RenderedBitmap m_renderedIcon;
         wxString m_label;
         wxString m_fullFilePath;
+        // for file buttons, taken when the file is checked
+        // (painting uses this and never touches the file system)
+        FileInfo m_fileInfo;
+        // for file buttons, whether a check has been requested
+        // (files are only checked once they are scrolled into view)
+        bool m_probed{ false };
+        // for file buttons, whether the file's folder is counted in the watched folders
+        bool m_watched{ false };
+        // for file buttons, the file's path in the filter index
+        uint32_t m_filterId{ 0 };
+        // for file buttons, the modified time as shown (e.g., "12 minutes ago")
+        // and when it needs to be reformatted (invalid if it never does)
+        wxString m_timeLabel;
+        wxDateTime m_timeLabelExpiration;
+        bool m_timeLabelValid{ false };
         wxWindowID m_id{ wxNOT_FOUND };
     };
 
+    /// @brief The fonts that the page is drawn with.
+    enum class PageFont
+    {
+        // file paths, modified times, and messages in the MRU list
+        Normal,
+        // file names and the button under the MRU list
+        Larger,
+        // the MRU list's header
+        Largest,
+        Greeting,
+        // the application name
+        Logo
+    };
+
     enum class ActiveButtonType
     {
         CustomButton,
@@ -297,54 +827,489 @@ private:
         FileActionButton
     };
 
-    /// @returns The number of items in the MRU list.
-    /// @note This is the number of files in the list,
-    ///     not including the "clear file list" or "browse" button.
+    enum class FileProbeState
+    {
+        Pending,
+        Found,
+        // found according to the metadata cache (not checked yet)
+        Cached,
+        Missing
+    };
+
+    /// @brief A file from the MRU list and what is known about it on disk.
+    struct FileProbe
+    {
+        wxString m_filePath;
+        FileInfo m_info;
+        FileProbeState m_state{ FileProbeState::Pending };
+        // how long the file system took to check it
+        std::chrono::nanoseconds m_latency{ 0 };
+    };
+
+    /// @brief A file whose probe timed out, and when it can be tried again.
+    struct ProbeBackoff
+    {
+        size_t m_timeoutCount{ 0 };
+        std::chrono::steady_clock::time_point m_retryTime;
+    };
+
+    /// @brief A standard user folder, and what it is shown as in file paths.
+    struct UserFolderPrefix
+    {
+        wxString m_path;
+        wxString m_label;
+    };
+
+    /// @brief The result of a background probe, posted back to the UI thread.
+    struct FileProbeResult
+    {
+        size_t m_generation{ 0 };
+        // where the file was when it was queued (rows may have moved since)
+        size_t m_row{ 0 };
+        wxString m_filePath;
+        FileInfo m_info;
+        std::chrono::nanoseconds m_latency{ 0 };
+    };
+
+    class FileProbePool;
+    class FileProbeWaiter;
+    class SharedArtCache;
+    class ArtBundleImpl;
+
+    /// @brief Times a hot path into one of the stats' timings
+    ///     (only reading the clock if the stats are enabled).
+    class StatsTimer
+    {
+    public:
+        StatsTimer(const bool enabled, wxStartPageStats::Timing& timing) :
+            m_timing(enabled ? &timing : nullptr),
+            m_start(enabled ? std::chrono::steady_clock::now() :
+                              std::chrono::steady_clock::time_point{})
+        {
+        }
+        StatsTimer(const StatsTimer&) = delete;
+        StatsTimer& operator=(const StatsTimer&) = delete;
+        ~StatsTimer()
+        {
+            if (m_timing != nullptr)
+            {
+                m_timing->Add(std::chrono::steady_clock::now() - m_start);
+            }
+        }
+    private:
+        wxStartPageStats::Timing* m_timing{ nullptr };
+        std::chrono::steady_clock::time_point m_start;
+    };
+    class FileFilterIndex;
+
+    /// @returns @c true if the MRU list is being filtered by search text.
     [[nodiscard]]
-    size_t GetMRUFileCount() const noexcept
+    bool IsFileListFiltered() const noexcept
+    {
+        return !m_fileFilter.empty();
+    }
+    /// @returns The number of rows shown in the MRU list
+    ///     (i.e., the files that match the filter).
+    [[nodiscard]]
+    size_t GetFileRowCount() const noexcept
+    {
+        return IsFileListFiltered() ? m_filteredRows.size() : m_fileButtons.size();
+    }
+    /// @returns The index (into the files) of the file shown in a row.
+    [[nodiscard]]
+    size_t GetFileRowEntry(const size_t row) const noexcept
+    {
+        return IsFileListFiltered() ? m_filteredRows[row] : row;
+    }
+    /// @returns The row showing a file (by its index into the files), or if that file
+    ///     is filtered out, then the first row after it (which may be GetFileRowCount()).
+    [[nodiscard]]
+    size_t FindEntryRow(const size_t entry) const
+    {
+        if (!IsFileListFiltered())
+        {
+            return entry;
+        }
+        return static_cast<size_t>(
+            std::lower_bound(m_filteredRows.cbegin(), m_filteredRows.cend(), entry) -
+            m_filteredRows.cbegin());
+    }
+    /// @returns The index (into the files) of the highlighted file,
+    ///     or @c wxString::npos if a file isn't highlighted.
+    [[nodiscard]]
+    size_t GetActiveFileEntry() const noexcept
+    {
+        return (IsFileId(m_activeButton) && GetFileRow(m_activeButton) < GetFileRowCount()) ?
+            GetFileRowEntry(GetFileRow(m_activeButton)) :
+            wxString::npos;
+    }
+    /// @returns The ID of a row in the MRU list.
+    [[nodiscard]]
+    static wxWindowID GetFileRowId(const size_t row) noexcept
     {
-        // the last item is the "clear file list" button (or "browse" button if empty),
-        // so don't count that
-        return !m_fileButtons.empty() ?
-            m_fileButtons.size() - 1 :
-            0;
+        return ID_FILE_ID_START + static_cast<wxWindowID>(row);
+    }
+    /// @returns The row of a file ID in the MRU list.
+    [[nodiscard]]
+    static size_t GetFileRow(const wxWindowID id) noexcept
+    {
+        return static_cast<size_t>(id - ID_FILE_ID_START);
+    }
+    /// @returns @c true if @c id is the "clear file list" or "browse" button.
+    [[nodiscard]]
+    static bool IsFileListButtonId(const wxWindowID id) noexcept
+    {
+        return IsFileListClearId(id) || IsBrowseId(id);
     }
 
     void OnResize([[maybe_unused]] wxSizeEvent& event);
+    void OnDPIChanged(wxDPIChangedEvent& event);
     void OnPaintWindow([[maybe_unused]] wxPaintEvent& event);
+    /// @brief Draws the page (what intersects the update region, that is)
+    ///     after updating the layout and backdrop as needed.
+    void DrawPage(wxDC& dc, const wxRegion& updateRegion);
     void OnMouseChange(wxMouseEvent& event);
+    /// @brief Hit-tests the latest mouse position (queued by OnMouseChange())
+    ///     and invalidates the highlight if it moved.
+    /// @param firstMove When the first of the moves being handled arrived
+    ///     (only set if the stats are enabled).
+    void UpdateHover(const std::chrono::steady_clock::time_point firstMove);
     void OnMouseClick(wxMouseEvent& event);
     void OnMouseLeave([[maybe_unused]] wxMouseEvent& event);
+    void OnMouseWheel(wxMouseEvent& event);
     void OnKeyDown(wxKeyEvent& event);
     void OnSetFocus(wxFocusEvent& event);
     void OnKillFocus(wxFocusEvent& event);
 
     void ActivateButton(wxWindowID id);
 
+    /// @brief Checks whether a file exists and reads its modification time and size.
+    /// @details This is safe to call from a worker thread.
+    /// @param filePath The file to check.
+    /// @param remotePolicy How to handle the file if it is on a remote file system.
+    /// @param deferRemote @c true to not read a remote file's metadata, but
+    ///     rather mark it as needing a background probe.
+    [[nodiscard]]
+    static FileProbe ProbeFile(const wxString& filePath,
+                               const wxStartPageRemoteFilePolicy remotePolicy,
+                               const bool deferRemote);
+    /// @brief Checks a file on the UI thread, using the client's
+    ///     metadata source if one was set.
+    [[nodiscard]]
+    FileProbe ProbeFileNow(const wxString& filePath,
+                           const wxStartPageRemoteFilePolicy remotePolicy,
+                           const bool deferRemote);
+    /// @returns A probe for a file that didn't respond in time.
+    [[nodiscard]]
+    FileProbe MakeTimedOutProbe(const wxString& filePath) const;
+    /// @brief Checks the files at the top of the list on the UI thread,
+    ///     waiting on them up to one deadline (for all of them).
+    /// @param mruFiles The files to check, in order.
+    /// @param maxFound Stop after this many files are found.
+    /// @returns The files that were checked (found or not), in order.
+    ///     Files that weren't checked by the deadline are left pending
+    ///     (or at the end, left out), to be checked in the background.
+    [[nodiscard]]
+    std::vector<FileProbe> ProbeFilesWithDeadline(const wxArrayString& mruFiles,
+                                                  const size_t maxFound);
+    /// @brief Counts a file system check that finished (for the stats).
+    void RecordFileProbe(const std::chrono::nanoseconds latency) noexcept
+    {
+        if (m_statsEnabled)
+        {
+            m_stats.AddProbeLatency(latency);
+        }
+    }
+    /// @brief Counts a cache lookup (for the stats).
+    void CountCacheLookup(wxStartPageStats::CacheCounter& counter, const bool hit) noexcept
+    {
+        if (m_statsEnabled)
+        {
+            ++(hit ? counter.m_hits : counter.m_misses);
+        }
+    }
+    /// @brief Invalidates an area whose highlight changed from the mouse moving.
+    void RefreshHover(const wxRect& rect)
+    {
+        m_pendingPaints |= PAINT_HOVER;
+        wxWindow::Refresh(true, &rect);
+    }
+    /// @brief Records a probe that timed out, doubling how long until it
+    ///     (or anything else in its folder) is retried.
+    void RecordProbeTimeout(const wxString& filePath);
+    /// @returns @c true if a file (or its folder) recently timed out
+    ///     and shouldn't be probed yet.
+    [[nodiscard]]
+    bool IsProbeBackingOff(const wxString& filePath) const;
+    /// @brief Forgets that a file (and its folder) timed out, after it responded.
+    void ClearProbeBackoff(const wxString& filePath);
+    /// @returns The folder of a file. A hung mount hangs everything in it, so probes
+    ///     are backed off from (and only run one at a time in) a folder as a whole.
+    [[nodiscard]]
+    static wxString GetProbeDirectory(const wxString& filePath)
+    {
+        return wxFileName{ filePath }.GetPath();
+    }
+    /// @brief Gives up on background probes that are past their deadlines.
+    void OnProbeDeadline([[maybe_unused]] wxTimerEvent& event);
+    /// @brief Queues background probes for the rows scrolled into view
+    ///     that haven't been checked yet.
+    void ProbeVisibleRows();
+    /// @brief Queues a background probe, which is given up on after the probe timeout.
+    /// @param filePath The file to check.
+    /// @param entryHint Where the file is (or would be) in the list.
+    void QueueFileProbe(const wxString& filePath, const size_t entryHint);
+    /// @returns What the metadata cache knows about each file in a list
+    ///     (@c Pending for files that aren't in it), or an empty vector if the
+    ///     cache couldn't be read or has none of the files.
+    [[nodiscard]]
+    std::vector<FileProbe> LoadFileInfoCache(const wxArrayString& mruFiles) const;
+    /// @brief Re-checks the files near the top of the list that the metadata cache
+    ///     said were missing (they may have been recreated since).
+    void ProbeCachedMissingFiles(const std::vector<FileProbe>& probes);
+    /// @returns A file's folder, with standard user folders shortened
+    ///     (e.g., "Documents") and separators replaced with guillemets.
+    /// @details This is a single pass over the path (the user folders are
+    ///     looked up beforehand), which only allocates the returned string.
+    [[nodiscard]]
+    wxString SimplifyFilePath(const wxString& filePath);
+    /// @returns The current time, from the client's clock (if one was set).
+    [[nodiscard]]
+    wxDateTime GetCurrentTime() const
+    {
+        return m_clock ? m_clock() : wxDateTime::Now();
+    }
+    /// @returns How long ago a file was modified, in a human-readable format
+    ///     (e.g., "Just now", "12 minutes ago", "Yesterday at 1:07 PM").
+    /// @param modTime When the file was modified.
+    /// @param now The current time.
+    /// @param[out] expiration When the label will need to change
+    ///     (e.g., when "Just now" becomes "10 minutes ago").
+    [[nodiscard]]
+    static wxString FormatFileDateTime(const wxDateTime& modTime, const wxDateTime& now,
+                                       wxDateTime& expiration);
+    /// @returns A file's modified time (or "Unavailable") as shown in its row,
+    ///     formatting it if it hasn't been yet (or the previous label has expired).
+    const wxString& GetFileTimeLabel(wxStartPageButton& fileButton, const wxDateTime& now);
+    /// @returns A bitmap bundle's image at a (logical) size, only rasterizing it
+    ///     if it hasn't already been at this size and the current content scale factor.
+    /// @param bundle The bitmap bundle.
+    /// @param[in,out] rendered Where the bundle's image was last rasterized to.
+    /// @param size The (logical) size to draw the image at.
+    const wxBitmap& GetRenderedBitmap(const wxBitmapBundle& bundle, RenderedBitmap& rendered,
+                                      const wxSize size);
+    /// @brief Rasterizes the logo and button icons at their current sizes,
+    ///     so that painting never has to.
+    void PrepareBitmaps();
+    /// @returns A bundle for stock art that only asks for a bitmap once a size is
+    ///     requested (and keeps the last one), which comes from the art cache
+    ///     shared by all start pages.
+    [[nodiscard]]
+    static wxBitmapBundle CreateArtBundle(const wxArtID& artId);
+    /// @brief Starts the timer for when the next modified time label in view expires.
+    void ScheduleTimeLabelRefresh(const wxDateTime& now);
+    /// @brief Redraws the rows whose modified time labels have expired.
+    void OnTimeLabelsExpired([[maybe_unused]] wxTimerEvent& event);
+    /// @brief Caches the backdrop again once the window stops being resized.
+    void OnResizeSettled([[maybe_unused]] wxTimerEvent& event);
+    /// @returns @c true while the window is being resized
+    ///     (i.e., it was resized within the last @c RESIZE_SETTLE_DELAY).
+    [[nodiscard]]
+    bool IsLiveResizing() const
+    {
+        return m_resizeSettleTimer.IsRunning() && !m_renderSize.IsFullySpecified();
+    }
+    /// @brief Fills the MRU rows from the client's list.
+    /// @param probes The files at the top of the list that were already checked
+    ///     (the rest are shown unchecked).
+    void BuildFileRows(const std::vector<FileProbe>& probes);
+    /// @brief Sorts the rows at the top whose modified times are known
+    ///     (up to a page of them) newest first.
+    void SortFileRows();
+    /// @brief Sets the button under the MRU list to either "Clear file list"
+    ///     or (if the list is empty) "Browse for a file."
+    void UpdateFileListButton();
+    /// @brief Handles a background probe result (on the UI thread).
+    void OnFileProbed(const FileProbeResult& result);
+    /// @returns @c true if two paths refer to the same file (without touching the disk).
+    [[nodiscard]]
+    static bool IsSameFilePath(const wxString& lhv, const wxString& rhv)
+    {
+        return lhv.IsSameAs(rhv, wxFileName::IsCaseSensitive());
+    }
+
+    void OnFileSystemChange(wxFileSystemWatcherEvent& event);
+    /// @brief Re-checks a file in the list after it was changed on disk
+    ///     (in the background if async probing is enabled).
+    void OnWatchedFileChanged(const wxString& filePath);
+    /// @brief Updates (or shows/hides) a single file in the list,
+    ///     invalidating only the rows that changed.
+    /// @param filePath The file.
+    /// @param fileInfo What is now known about the file.
+    /// @param rowHint Where the file is expected to be in the list.
+    void UpdateFileRow(const wxString& filePath, const FileInfo& fileInfo,
+                       const size_t rowHint = 0);
+    /// @brief Inserts an unchecked file into the list.
+    void InsertFileRow(const size_t row, const wxString& filePath);
+    /// @brief Removes a row from the list.
+    void RemoveFileRow(const size_t row);
+    /// @returns The row of a file in the list, or GetMRUFileCount() if it isn't shown.
+    /// @param filePath The file to look for.
+    /// @param rowHint Where the file is expected to be (checked first).
+    [[nodiscard]]
+    size_t FindFileRow(const wxString& filePath, const size_t rowHint = 0) const;
+    /// @returns Where a file from the client's list belongs among the rows
+    ///     (the rows are in the same order as the client's list, other than the
+    ///     ones sorted at the top), or @c wxString::npos if it isn't in the client's list.
+    /// @param filePath The file to look for.
+    /// @param fileInfo The file's metadata (a newer file goes into the sorted rows).
+    [[nodiscard]]
+    size_t FindFileRowInsertPosition(const wxString& filePath, const FileInfo& fileInfo) const;
+    /// @returns The index of a file in the client's list,
+    ///     or the size of the list if it isn't in it.
+    [[nodiscard]]
+    size_t FindMRUIndex(const wxString& filePath) const;
+    /// @returns A hash of a list of file paths (to detect when the same list is set again).
+    [[nodiscard]]
+    static size_t HashFileList(const wxArrayString& files);
+    /// @returns The probe pool, creating it if necessary.
+    FileProbePool& GetProbePool();
+    /// @brief Syncs the watched folders with the files in the list
+    ///     (e.g., after a new list is set).
+    void UpdateWatchedDirectories();
+    /// @brief Counts a file toward watching its folder (watching it if it is the first).
+    void WatchFileDirectory(const wxString& filePath);
+    /// @brief Stops counting a file toward watching its folder
+    ///     (no longer watching it if it was the last).
+    void UnwatchFileDirectory(const wxString& filePath);
+    /// @brief Watches the folder of a row that has been checked (if it isn't already).
+    void WatchFileRow(wxStartPageButton& fileButton);
+    /// @brief Stops watching the folder of a row (e.g., before it is removed).
+    void UnwatchFileRow(wxStartPageButton& fileButton);
+    /// @returns A file path as it is compared on this platform
+    ///     (i.e., case folded if file names aren't case sensitive), to key hash maps with.
+    [[nodiscard]]
+    static std::wstring MakeFilePathKey(const wxString& filePath)
+    {
+        return wxFileName::IsCaseSensitive() ?
+            filePath.ToStdWstring() : filePath.Lower().ToStdWstring();
+    }
+    /// @returns @c true if the files' folders are being watched.
+    [[nodiscard]]
+    bool HasFileWatcher() const noexcept
+    {
+#if wxUSE_FSWATCHER
+        return m_fileWatcher != nullptr;
+#else
+        return false;
+#endif
+    }
+    /// @brief Indexes the paths of the files for the search box
+    ///     (and reapplies the filter to them).
+    void BuildFileFilterIndex();
+    /// @brief Rebuilds the search box's index if most of it is for
+    ///     files that have since been removed from the list.
+    void TrimFileFilterIndex();
+    /// @brief Rebuilds which rows are shown from the files that match the filter.
+    void FilterFileRows();
+    /// @brief Reapplies the filter after files were added, removed, or moved,
+    ///     and redraws the list.
+    /// @param activeEntry The highlighted file (by its index into the files after the change),
+    ///     or @c wxString::npos. If it is filtered out, the row after it is highlighted.
+    void RefilterFileRows(const size_t activeEntry);
+    /// @returns The height of the search box (and the padding around it),
+    ///     or zero if it isn't shown.
+    [[nodiscard]]
+    wxCoord GetFileFilterHeight() const;
+    /// @brief Invalidates the MRU rows from @c firstRow to @c lastRow (inclusive).
+    /// @details If @c lastRow is past the end of the list, then everything below
+    ///     @c firstRow (including the button under the list) is invalidated.
+    void RefreshFileRows(const size_t firstRow, const size_t lastRow);
+
+    /// @returns The most height that the MRU rows can take up
+    ///     before the list has to scroll.
+    [[nodiscard]]
+    wxCoord GetFileRowsMaxHeight() const;
+    /// @returns The number of MRU rows that fit on the page.
+    [[nodiscard]]
+    size_t GetFileRowsPerPage() const;
+    /// @returns The area that the MRU rows are scrolled within.
+    [[nodiscard]]
+    wxRect GetFileRowsViewRect() const;
+    /// @returns The area of a row in the MRU list (which may be scrolled out of view).
+    [[nodiscard]]
+    wxRect GetFileRowRect(const size_t row) const;
+    /// @returns The rows that are (at least partially) scrolled into view,
+    ///     as the first row and one past the last row.
+    [[nodiscard]]
+    std::pair<size_t, size_t> GetVisibleFileRows() const;
+    /// @returns How far the MRU list can be scrolled.
+    [[nodiscard]]
+    wxCoord GetMaxFileScrollPosition() const;
+    /// @brief Scrolls the MRU list (clamped to its size).
+    /// @param position The number of pixels to scroll the list down.
+    void ScrollFileRows(const wxCoord position);
+    /// @brief Scrolls the MRU list (if necessary) so that a row is fully shown.
+    void EnsureFileRowVisible(const size_t row);
+    /// @returns The area of the button (or MRU row) with the given ID,
+    ///     or an empty rect if it isn't shown.
+    [[nodiscard]]
+    wxRect GetButtonRect(const wxWindowID id) const;
+    /// @returns The ID of the button (or MRU row) under a point, or @c wxNOT_FOUND.
+    /// @details The buttons and rows are each a fixed height, so this is calculated
+    ///     from the point rather than by searching through them.
+    [[nodiscard]]
+    wxWindowID HitTest(const wxPoint& pt) const;
+    /// @brief Moves the keyboard focus within the MRU list
+    ///     (rows, then the button under it).
+    /// @param offset How many items to move by (negative to move up).
+    /// @param wrap @c true to wrap around the ends of the list.
+    void MoveFileListFocus(const long offset, const bool wrap);
+
     static constexpr int MAX_BUTTONS_SMALL_SIZE = 8;
-    static constexpr int MAX_FILE_BUTTONS = 9;
-    // supports 9 MRU file buttons
-    static constexpr int ID_FILE_ID_START = wxID_HIGHEST;
+    static constexpr size_t PAGE_FONT_COUNT = 5;
+    // text sizes remembered per font before starting over
+    // (file names and paths scrolling by would otherwise pile up)
+    static constexpr size_t MAX_CACHED_TEXT_EXTENTS = 2048;
+    // parts of the layout, which are recalculated only after something they depend on changes
+    // the app header and custom buttons (font, DPI, buttons, app header style)
+    static constexpr uint8_t LAYOUT_BUTTON_AREA = 0x01;
+    // the MRU list's header and row height (also greeting, search box)
+    // (resizing only moves the areas, reusing these measurements)
+    static constexpr uint8_t LAYOUT_FILE_AREA = 0x02;
+    // the rows in view and the button under them (also rows changed or scrolled)
+    static constexpr uint8_t LAYOUT_FILE_ROWS = 0x04;
+    static constexpr uint8_t LAYOUT_ALL =
+        LAYOUT_BUTTON_AREA | LAYOUT_FILE_AREA | LAYOUT_FILE_ROWS;
+    // why the page was invalidated (for the stats)
+    static constexpr uint8_t PAINT_HOVER = 0x01;
+    static constexpr uint8_t PAINT_CONTENT = 0x02;
+    // rows checked up front if the window hasn't been laid out yet
+    static constexpr size_t INITIAL_FILE_ROWS = 9;
+    // how long after the last size event that resizing is considered finished
+    static constexpr std::chrono::milliseconds RESIZE_SETTLE_DELAY{ 150 };
+    static constexpr size_t MAX_PROBE_THREADS = 8;
+    // how long a probe worker waits for another file before its thread exits
+    static constexpr std::chrono::seconds PROBE_WORKER_IDLE_TIMEOUT{ 10 };
+    // how long a file that timed out waits before being probed again
+    // (doubled after each timeout, up to the maximum)
+    static constexpr std::chrono::seconds PROBE_BACKOFF_START{ 30 };
+    static constexpr std::chrono::seconds PROBE_BACKOFF_MAX{ 30 * 60 };
+    // bumped whenever the metadata cache's layout changes
+    static constexpr uint32_t FILE_INFO_CACHE_VERSION = 1;
     /// @brief ID returned when the "Clear file list" button is clicked.
     /// @details Client code can check for this in their @c wxEVT_STARTPAGE_CLICKED
     ///     handler and clear the application's file history.
-    static constexpr int START_PAGE_FILE_LIST_CLEAR =
-        wxID_HIGHEST + MAX_FILE_BUTTONS;
+    static constexpr int START_PAGE_FILE_LIST_CLEAR = wxID_HIGHEST;
     /// @brief ID returned when the "Browse for a file" button is clicked.
     /// @details Client code can check for this in their @c wxEVT_STARTPAGE_CLICKED
     ///     handler and open a file dialog.
-    static constexpr int START_PAGE_BROWSE_FILE =
-        wxID_HIGHEST + MAX_FILE_BUTTONS + 1;
-    static constexpr int ID_BUTTON_ID_START =
-        wxID_HIGHEST + MAX_FILE_BUTTONS + 2;
+    static constexpr int START_PAGE_BROWSE_FILE = wxID_HIGHEST + 1;
+    static constexpr int ID_BUTTON_ID_START = wxID_HIGHEST + 2;
+    // one ID per MRU row, however many there are, so these are open ended
+    // (well above where the custom buttons' IDs could reach)
+    static constexpr int ID_FILE_ID_START = ID_BUTTON_ID_START + 0x100000;
 
-    /// @returns The number of items in the MRU list
-    ///     (including the "clear file list" button).
-    [[nodiscard]]
-    size_t GetMRUFileAndClearButtonCount() const noexcept
-    {
-        return m_fileButtons.size();
-    }
     /// @returns The padding height around the labels.
     [[nodiscard]]
     static wxCoord GetLabelPaddingHeight()
@@ -375,6 +1340,12 @@ private:
     {
         return FromDIP(wxSize{ 64, 64 });
     }
+    /// @returns The size of the logo shown next to each file in the MRU list.
+    [[nodiscard]]
+    static wxSize GetFileIconSize()
+    {
+        return wxSize{ 32, 32 };
+    }
     /// @returns The button size, which will be smaller if there
     ///     are numerous buttons.
     [[nodiscard]]
@@ -383,12 +1354,26 @@ private:
         return FromDIP(m_buttons.size() > MAX_BUTTONS_SMALL_SIZE ?
             wxSize{ 16, 16 } : wxSize{ 32, 32 });
     }
+    /// @returns The size that the page is laid out and drawn at
+    ///     (the client area, unless the page is being rendered to a bitmap).
+    [[nodiscard]]
+    wxSize GetPageSize() const
+    {
+        return m_renderSize.IsFullySpecified() ? m_renderSize : GetClientSize();
+    }
+    /// @returns The content scale factor that the page is drawn at
+    ///     (the window's, unless the page is being rendered to a bitmap).
+    [[nodiscard]]
+    double GetPageScaleFactor() const
+    {
+        return (m_renderScaleFactor > 0) ? m_renderScaleFactor : GetContentScaleFactor();
+    }
     [[nodiscard]]
     wxSize ScaleToContentSize(const wxSize sz) const
     {
         auto scaledSize{ sz };
         // for Retina display
-        const double scaling = GetContentScaleFactor();
+        const double scaling = GetPageScaleFactor();
 
         scaledSize = wxSize{ wxRound(scaledSize.GetWidth() * scaling),
                             wxRound(scaledSize.GetHeight() * scaling) };
@@ -417,15 +1402,115 @@ private:
         return _(L"You haven't opened any files recently.");
     }
     [[nodiscard]]
+    static wxString GetNoMatchingFilesLabel()
+    {
+        return _(L"No recent files match your search.");
+    }
+    [[nodiscard]]
     static wxString GetBrowseForFileLabel()
     {
         return _(L"Browse for a file...");
     }
+    [[nodiscard]]
+    static wxString GetUnavailableFileLabel()
+    {
+        // TRANSLATORS: A file on a network drive that can't be reached.
+        return _(L"Unavailable");
+    }
     void DrawHighlight(wxDC& dc, const wxRect& rect, const wxColour& color) const;
+    /// @returns @c true if the page is drawn through a @c wxGCDC
+    ///     (rather than directly with the window's DC).
+    [[nodiscard]]
+    bool IsUsingGCDC() const noexcept;
+    /// @returns A translucent color as it should be drawn over a background.
+    /// @details If the DC can't blend colors, then this is the color already
+    ///     blended with the background (otherwise, it is returned as-is).
+    [[nodiscard]]
+    wxColour GetOverlayColor(const wxColour& color, const wxColour& background) const;
+    /// @brief Builds the fonts that the page is drawn with
+    ///     (and forgets the text measured with the previous ones).
+    void BuildPageFonts();
+    [[nodiscard]]
+    const wxFont& GetPageFont(const PageFont font) const noexcept
+    {
+        return m_pageFonts[static_cast<size_t>(font)];
+    }
+    /// @returns The font that the custom buttons' labels are drawn with.
+    [[nodiscard]]
+    PageFont GetButtonFont() const noexcept
+    {
+        return (m_buttons.size() > MAX_BUTTONS_SMALL_SIZE) ? PageFont::Normal : PageFont::Larger;
+    }
+    /// @returns The size of a string in one of the page's fonts.
+    /// @details The string is only measured (with @c dc) the first time it is asked for.
+    [[nodiscard]]
+    wxSize MeasureText(wxDC& dc, const PageFont font, const wxString& text);
+    /// @brief Draws a single-line label the same way that @c wxDC::DrawLabel() does,
+    ///     but with the text's size from MeasureText().
+    /// @param hasMnemonic @c true if the text is a button label, where (like with
+    ///     @c wxDC::DrawLabel()) an "&" underlines the next character and "&&" is an "&".
+    ///     Otherwise (e.g., file names), the text is drawn as is.
+    void DrawPageLabel(wxDC& dc, const PageFont font, const wxString& text,
+                       const wxBitmap& bitmap, const wxRect& rect,
+                       const int alignment = wxALIGN_LEFT | wxALIGN_TOP,
+                       const bool hasMnemonic = false);
+    /// @returns A button label with its mnemonic markers removed
+    ///     (i.e., what DrawPageLabel() shows, and what should be measured).
+    /// @param label The label.
+    /// @param[out] mnemonicIndex If not null, where the underlined character is in
+    ///     the returned text (or @c wxString::npos if there isn't one).
+    [[nodiscard]]
+    static wxString StripMnemonic(const wxString& label, size_t* mnemonicIndex = nullptr);
+    /// @brief Marks parts of the layout as needing to be recalculated
+    ///     (the next time the page is drawn or resized).
+    /// @param parts The @c LAYOUT_ flags of the parts that changed.
+    void InvalidateLayout(const uint8_t parts) noexcept
+    {
+        m_layoutDirty |= parts;
+    }
+    /// @brief Recalculates the parts of the layout that are out of date.
+    /// @details Anything that a part depends on is also recalculated
+    ///     (e.g., the MRU list moves if the buttons on the left get wider).
+    /// @param dc The DC to measure text with.
+    /// @param parts The @c LAYOUT_ flags of the parts to update (if they need it).
+    void UpdateLayout(wxDC& dc, const uint8_t parts = LAYOUT_ALL);
     void CalcButtonStart(wxDC& dc);
+    void CalcButtonSizes(wxDC& dc);
     void CalcMRUColumnHeaderHeight(wxDC& dc);
+    void CalcMRUButtonHeight(wxDC& dc);
+    /// @brief Redraws the backdrop (if the page has a size).
+    void UpdateBackdrop();
+    /// @returns @c true if the backdrop was drawn for the page's current
+    ///     size, scale, greeting, and appearance.
+    [[nodiscard]]
+    bool IsBackdropCurrent();
+    /// @brief Draws the parts of the page that don't change between content changes:
+    ///     the backgrounds, app header, greeting, and MRU header.
+    void DrawBackdrop(wxDC& dc);
+    /// @brief Calculates the areas of the page from the button width and header heights.
+    void CalcPageAreas();
+    /// @brief Positions the "clear file list" (or "browse") button under the MRU list.
+    void CalcFileListButtonRect(wxDC& dc);
+    /// @brief Measures the widest path and modified time labels of the rows
+    ///     scrolled into view (building the labels if needed).
+    void CalcFileLabelWidths(wxDC& dc);
+    /// @returns The greeting for the current time (from the client's clock, if one was set).
+    /// @details The greeting is formatted once and kept until it changes
+    ///     (at noon, 5 PM, or midnight), like the modified time labels.
+    [[nodiscard]]
+    const wxString& GetGreeting();
+    /// @brief Has the greeting formatted again the next time it is needed
+    ///     (e.g., after its style or the clock changes).
+    void InvalidateGreeting() noexcept
+    {
+        m_greetingValid = false;
+    }
+    /// @returns The greeting for a given time.
+    /// @param now The current time.
+    /// @param[out] expiration When the greeting should be formatted again
+    ///     (invalid if it never changes).
     [[nodiscard]]
-    wxString FormatGreeting() const;
+    wxString FormatGreeting(const wxDateTime& now, wxDateTime& expiration) const;
     /// @brief Determines whether a color is dark.
     /// @details "Dark" is defined as luminance being less than 50% and
     ///     opacity higher than 32. For example, black having an opacity of 32
@@ -473,22 +1558,127 @@ private:
     wxCoord m_buttonsStart{ 0 };
     wxCoord m_fileColumnHeaderHeight{ 0 };
     wxCoord m_mruButtonHeight{ 0 };
+    wxCoord m_fileListButtonHeight{ 0 };
+    wxRect m_buttonsArea;
+    wxRect m_filesArea;
+    wxRect m_greetingRect;
+    wxRect m_recentRect;
+    // the widest path label of the rows in view
+    wxCoord m_filePathLabelWidth{ 0 };
+    uint8_t m_layoutDirty{ LAYOUT_ALL };
+    uint8_t m_pendingPaints{ 0 };
+    // the latest mouse position that hasn't been hit-tested yet
+    // (wxDefaultPosition if none), and whether UpdateHover() is queued for it
+    wxPoint m_hoverPosition{ wxDefaultPosition };
+    bool m_hoverUpdateQueued{ false };
+    // when the first mouse move whose highlight hasn't been painted yet arrived (for the stats)
+    std::chrono::steady_clock::time_point m_hoverStart;
+    // the static parts of the page, drawn at the window's size and scale
+    // (each paint copies the invalidated parts of it and draws the rows and buttons on top)
+    wxBitmap m_backdrop;
+    // the greeting drawn on the backdrop (which changes with the time of day)
+    wxString m_backdropGreeting;
+    // the current greeting, and when it should be formatted again
+    wxString m_greeting;
+    wxDateTime m_greetingExpiration;
+    bool m_greetingValid{ false };
+    bool m_backdropDirty{ true };
+    // how far (in pixels) the MRU list is scrolled down
+    wxCoord m_fileScrollPosition{ 0 };
     wxWindowID m_activeButton{ wxNOT_FOUND };
     wxStartPageStyle m_style{ wxStartPageStyle::wxStartPageFlat };
+    wxStartPageRenderer m_renderer{ wxStartPageRenderer::wxStartPageDefaultRenderer };
     wxStartPageGreetingStyle m_greetingStyle
     { wxStartPageGreetingStyle::wxDynamicGreetingWithUserName };
     wxString m_customGreeting;
     wxStartPageAppHeaderStyle m_appHeaderStyle
     { wxStartPageAppHeaderStyle::wxStartPageAppNameAndLogo };
-    wxFont m_logoFont;
+    std::array<wxFont, PAGE_FONT_COUNT> m_pageFonts;
+    std::array<std::map<wxString, wxSize>, PAGE_FONT_COUNT> m_textExtents;
+    // the files shown in the MRU list (in the client's order)
     std::vector<wxStartPageButton> m_fileButtons;
+    // the "clear file list" (or "browse") button under the MRU list
+    wxStartPageButton m_fileListButton;
     std::vector<wxStartPageButton> m_buttons;
     wxBitmapBundle m_logo;
+    RenderedBitmap m_renderedLogo;
+    RenderedBitmap m_renderedFileIcon;
+    // the size (and scale) to lay out and draw at, when rendering to a bitmap
+    wxSize m_renderSize{ wxDefaultSize };
+    double m_renderScaleFactor{ 0 };
     wxString m_toolTip;
     wxString m_productDescription;
     wxColour m_buttonAreaBackgroundColor{ 145, 168, 208 };
     wxColour m_MRUBackgroundColor{ 255, 255, 255 };
     wxString m_userName{ wxGetUserName() };
+
+    // background file probing
+    bool m_asyncFileProbing{ false };
+    size_t m_probeGeneration{ 0 };
+    // background probes that haven't finished, and when they are given up on
+    std::map<wxString, std::chrono::steady_clock::time_point> m_probesInFlight;
+    std::shared_ptr<FileProbePool> m_probePool;
+    std::chrono::milliseconds m_probeTimeout{ 2000 };
+    wxStartPageRemoteFilePolicy m_remoteFilePolicy
+        { wxStartPageRemoteFilePolicy::wxProbeRemoteFiles };
+    wxStartPageFileOrder m_fileOrder{ wxStartPageFileOrder::wxSortFilesByModifiedTime };
+    // the rows at the top that were sorted by modified time
+    size_t m_sortedFileRowCount{ 0 };
+    std::map<wxString, ProbeBackoff> m_probeBackoffs;
+    // folders that a probe timed out in
+    std::map<wxString, ProbeBackoff> m_probeDirectoryBackoffs;
+    wxTimer m_probeDeadlineTimer;
+
+    // the list from the client (before missing files are filtered out)
+    wxArrayString m_mruFiles;
+    size_t m_mruFilesHash{ 0 };
+    bool m_mruFilesLoaded{ false };
+    wxString m_fileInfoCachePath;
+    // refreshing the modified time labels
+    std::function<wxDateTime()> m_clock;
+    std::function<wxDateTime(const wxString&)> m_fileInfoSource;
+
+    bool m_statsEnabled{ false };
+    wxStartPageStats m_stats;
+    wxTimer m_timeLabelTimer;
+    wxTimer m_resizeSettleTimer;
+    // the widest modified time label of the rows in view
+    wxCoord m_timeLabelWidth{ 0 };
+
+    // the standard user folders (longest first), looked up when the first path is shown
+    // (shared with the other start pages)
+    std::shared_ptr<const std::vector<UserFolderPrefix>> m_userFolderPrefixes;
+    wxBitmapBundle m_browseIcon;
+
+    // file system monitoring
+    bool m_fileWatching{ false };
+#if wxUSE_FSWATCHER
+    // (only declared if it can be, since it is an incomplete type here)
+    std::unique_ptr<wxFileSystemWatcher> m_fileWatcher;
+    /// @brief A watched folder, and how many of the files being watched are in it.
+    struct WatchedDirectory
+    {
+        wxString m_path;
+        size_t m_fileCount{ 0 };
+    };
+    // keyed by MakeFilePathKey()
+    std::unordered_map<std::wstring, WatchedDirectory> m_watchedDirectories;
+#endif
+    // files removed from the list because they were deleted,
+    // kept so that their folders are still watched in case they are recreated
+    std::vector<wxString> m_deletedFiles;
+
+    // filtering the MRU list
+    bool m_fileFilterEnabled{ false };
+    wxSearchCtrl* m_searchCtrl{ nullptr };
+    std::unique_ptr<FileFilterIndex> m_fileFilterIndex;
+    wxString m_fileFilter;
+    // the filter, lowercased and UTF-8 encoded (how the index stores the paths)
+    std::string m_fileFilterKey;
+    // the files (by their IDs in the index) that match the filter, sorted
+    std::vector<uint32_t> m_filterMatches;
+    // the files (by their index into m_fileButtons) shown in each row while filtered
+    std::vector<size_t> m_filteredRows;
 };
 
 /** @}*/